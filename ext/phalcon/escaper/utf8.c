@@ -0,0 +1,381 @@
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2018 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "phalcon.h"
+
+#include <ctype.h>
+
+#if PHP_VERSION_ID < 70000
+#include <ext/standard/php_smart_str.h>
+#else
+#include <ext/standard/php_smart_string.h>
+#include <zend_smart_str.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "phalcon/escaper/utf8.h"
+
+/**
+ * Returns a bit mask with the bytes of a block that are not escaped:
+ * alphanumeric characters and, for escapeJs, the whitelisted ones. Every
+ * range is checked with one addition and one signed comparison, bytes
+ * over 0x7f never fall in them
+ */
+#if defined(__AVX2__)
+#define PHALCON_ESCAPE_BLOCK 32
+#define PHALCON_ESCAPE_RANGE(chars, lo, hi) \
+	_mm256_cmpgt_epi8(_mm256_set1_epi8((char) (-128 + (hi) - (lo) + 1)), _mm256_add_epi8(chars, _mm256_set1_epi8((char) (0x80 - (lo)))))
+
+static inline unsigned int phalcon_safe_mask(const char *block, int use_whitelist)
+{
+	__m256i chars = _mm256_loadu_si256((const __m256i *) block), safe;
+
+	safe = _mm256_or_si256(PHALCON_ESCAPE_RANGE(chars, '0', '9'), _mm256_or_si256(PHALCON_ESCAPE_RANGE(chars, 'A', 'Z'), PHALCON_ESCAPE_RANGE(chars, 'a', 'z')));
+
+	if (use_whitelist) {
+		safe = _mm256_or_si256(safe, _mm256_or_si256(PHALCON_ESCAPE_RANGE(chars, '\t', '\n'), PHALCON_ESCAPE_RANGE(chars, ' ', '!')));
+		safe = _mm256_or_si256(safe, _mm256_or_si256(PHALCON_ESCAPE_RANGE(chars, '#', '$'), PHALCON_ESCAPE_RANGE(chars, '(', '/')));
+		safe = _mm256_or_si256(safe, _mm256_or_si256(PHALCON_ESCAPE_RANGE(chars, ':', ';'), PHALCON_ESCAPE_RANGE(chars, '?', '?')));
+		safe = _mm256_or_si256(safe, _mm256_or_si256(PHALCON_ESCAPE_RANGE(chars, '[', '_'), PHALCON_ESCAPE_RANGE(chars, '{', '}')));
+	}
+
+	return (unsigned int) _mm256_movemask_epi8(safe);
+}
+#elif defined(__SSE2__)
+#define PHALCON_ESCAPE_BLOCK 16
+#define PHALCON_ESCAPE_RANGE(chars, lo, hi) \
+	_mm_cmplt_epi8(_mm_add_epi8(chars, _mm_set1_epi8((char) (0x80 - (lo)))), _mm_set1_epi8((char) (-128 + (hi) - (lo) + 1)))
+
+static inline unsigned int phalcon_safe_mask(const char *block, int use_whitelist)
+{
+	__m128i chars = _mm_loadu_si128((const __m128i *) block), safe;
+
+	safe = _mm_or_si128(PHALCON_ESCAPE_RANGE(chars, '0', '9'), _mm_or_si128(PHALCON_ESCAPE_RANGE(chars, 'A', 'Z'), PHALCON_ESCAPE_RANGE(chars, 'a', 'z')));
+
+	if (use_whitelist) {
+		safe = _mm_or_si128(safe, _mm_or_si128(PHALCON_ESCAPE_RANGE(chars, '\t', '\n'), PHALCON_ESCAPE_RANGE(chars, ' ', '!')));
+		safe = _mm_or_si128(safe, _mm_or_si128(PHALCON_ESCAPE_RANGE(chars, '#', '$'), PHALCON_ESCAPE_RANGE(chars, '(', '/')));
+		safe = _mm_or_si128(safe, _mm_or_si128(PHALCON_ESCAPE_RANGE(chars, ':', ';'), PHALCON_ESCAPE_RANGE(chars, '?', '?')));
+		safe = _mm_or_si128(safe, _mm_or_si128(PHALCON_ESCAPE_RANGE(chars, '[', '_'), PHALCON_ESCAPE_RANGE(chars, '{', '}')));
+	}
+
+	return (unsigned int) _mm_movemask_epi8(safe);
+}
+#endif
+
+#ifdef PHALCON_ESCAPE_BLOCK
+/**
+ * Number of consecutive bits set starting from the lowest one
+ */
+static inline unsigned int phalcon_trailing_ones(unsigned int bits)
+{
+	if (bits == 0xFFFFFFFFU) {
+		return 32;
+	}
+
+#if defined(__GNUC__) || defined(__clang__)
+	return (unsigned int) __builtin_ctz(~bits);
+#elif defined(_MSC_VER)
+	{
+		unsigned long index;
+		_BitScanForward(&index, ~bits);
+		return (unsigned int) index;
+	}
+#else
+	{
+		unsigned int count = 0;
+		while (bits & 1) {
+			bits >>= 1;
+			count++;
+		}
+		return count;
+	}
+#endif
+}
+#endif
+
+/**
+ * Same characters left as they are by zephir_escape_multi
+ */
+static inline int phalcon_escape_whitelisted(unsigned long value)
+{
+	switch (value) {
+		case ' ':
+		case '/':
+		case '*':
+		case '+':
+		case '-':
+		case '\t':
+		case '\n':
+		case '^':
+		case '$':
+		case '!':
+		case '?':
+		case '\\':
+		case '#':
+		case '}':
+		case '{':
+		case ')':
+		case '(':
+		case ']':
+		case '[':
+		case '.':
+		case ',':
+		case ':':
+		case ';':
+		case '_':
+		case '|':
+			return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * Decodes the UTF-8 character at the cursor, returns its length or zero if
+ * it's not valid. Code points that mbstring could treat differently
+ * (surrogates, non-characters) are rejected too so the caller falls back to
+ * the UTF-32 path
+ */
+static inline int phalcon_utf8_decode(const unsigned char *cursor, size_t available, unsigned long *value)
+{
+	unsigned char ch = cursor[0];
+	unsigned long cp;
+	int length, i;
+
+	if (ch >= 0xC2 && ch <= 0xDF) {
+		length = 2;
+		cp = ch & 0x1F;
+	} else if (ch >= 0xE0 && ch <= 0xEF) {
+		length = 3;
+		cp = ch & 0x0F;
+	} else if (ch >= 0xF0 && ch <= 0xF4) {
+		length = 4;
+		cp = ch & 0x07;
+	} else {
+		return 0;
+	}
+
+	if ((size_t) length > available) {
+		return 0;
+	}
+
+	for (i = 1; i < length; i++) {
+		if ((cursor[i] & 0xC0) != 0x80) {
+			return 0;
+		}
+		cp = (cp << 6) | (cursor[i] & 0x3F);
+	}
+
+	/* Overlong forms, surrogates and code points out of range */
+	if ((length == 3 && cp < 0x800) || (length == 4 && (cp < 0x10000 || cp > 0x10FFFF))) {
+		return 0;
+	}
+
+	if ((cp >= 0xD800 && cp <= 0xDFFF) || (cp >= 0xFDD0 && cp <= 0xFDEF) || (cp & 0xFFFE) == 0xFFFE) {
+		return 0;
+	}
+
+	*value = cp;
+	return length;
+}
+
+/**
+ * Appends the character at the cursor escaped if required, returns the
+ * number of bytes read or zero if the string must go through the UTF-32 path
+ */
+static inline int phalcon_escape_utf8_char(smart_str *escaped_str, const unsigned char *cursor, size_t available, const char *escape_char, unsigned int escape_length, char escape_extra, int use_whitelist, int *has_ascii)
+{
+	static const char digits[] = "0123456789abcdef";
+	unsigned long value;
+	char hex[(sizeof(unsigned long) << 1) + 1], *ptr;
+	int size;
+
+	if (cursor[0] < 0x80) {
+
+		/**
+		 * The UTF-32 path doesn't accept NUL characters
+		 */
+		if (cursor[0] == '\0') {
+			return 0;
+		}
+
+		*has_ascii = 1;
+		value = cursor[0];
+		size = 1;
+	} else {
+		size = phalcon_utf8_decode(cursor, available, &value);
+		if (!size) {
+			return 0;
+		}
+	}
+
+	/**
+	 * Alphanumeric characters are not escaped
+	 */
+	if (value < 256 && isalnum(value)) {
+		smart_str_appendc(escaped_str, (unsigned char) value);
+		return size;
+	}
+
+	/**
+	 * Chararters in the whitelist are left as they are
+	 */
+	if (use_whitelist && phalcon_escape_whitelisted(value)) {
+		smart_str_appendc(escaped_str, (unsigned char) value);
+		return size;
+	}
+
+	/**
+	 * Append the escaped character in hexadecimal
+	 */
+	ptr = hex + sizeof(hex) - 1;
+	*ptr = '\0';
+	do {
+		*--ptr = digits[value & 0x0F];
+		value >>= 4;
+	} while (ptr > hex && value);
+
+	smart_str_appendl(escaped_str, escape_char, escape_length);
+	smart_str_appendl(escaped_str, ptr, hex + sizeof(hex) - 1 - ptr);
+	if (escape_extra != '\0') {
+		smart_str_appendc(escaped_str, escape_extra);
+	}
+
+	return size;
+}
+
+/**
+ * Escapes non-alphanumeric characters of an UTF-8 string in a single pass,
+ * producing the same output as zephir_escape_multi on the UTF-32 version of
+ * the string. Returns false if the string is not valid UTF-8, contains NUL
+ * bytes or has no ASCII characters, since the encoding detection of the
+ * escaper may not read those strings as UTF-8
+ */
+void phalcon_escape_utf8(zval *return_value, zval *param, const char *escape_char, unsigned int escape_length, char escape_extra, int use_whitelist)
+{
+	const unsigned char *str;
+	size_t i = 0, length;
+	smart_str escaped_str = {0};
+	int size, has_ascii = 0;
+#ifdef PHALCON_ESCAPE_BLOCK
+	size_t start, end;
+	unsigned int mask, run;
+#endif
+
+	if (Z_TYPE_P(param) != IS_STRING || Z_STRLEN_P(param) <= 0) {
+		RETURN_FALSE;
+	}
+
+	str = (const unsigned char *) Z_STRVAL_P(param);
+	length = Z_STRLEN_P(param);
+
+#ifdef PHALCON_ESCAPE_BLOCK
+	/**
+	 * Every block is classified at once, runs of characters left as they are
+	 * are copied together and only the others are decoded one by one
+	 */
+	while (length - i >= PHALCON_ESCAPE_BLOCK) {
+
+		start = i;
+		end = i + PHALCON_ESCAPE_BLOCK;
+		mask = phalcon_safe_mask((const char *) str + i, use_whitelist);
+
+		if (mask) {
+			has_ascii = 1;
+		}
+
+		while (i < end) {
+
+			run = phalcon_trailing_ones(mask >> (i - start));
+			if (run > end - i) {
+				run = end - i;
+			}
+
+			if (run) {
+				smart_str_appendl(&escaped_str, (const char *) str + i, run);
+				i += run;
+				continue;
+			}
+
+			/**
+			 * Multi-byte characters can end after the block
+			 */
+			size = phalcon_escape_utf8_char(&escaped_str, str + i, length - i, escape_char, escape_length, escape_extra, use_whitelist, &has_ascii);
+			if (!size) {
+				smart_str_free(&escaped_str);
+				RETURN_FALSE;
+			}
+			i += size;
+		}
+	}
+#endif
+
+	while (i < length) {
+		size = phalcon_escape_utf8_char(&escaped_str, str + i, length - i, escape_char, escape_length, escape_extra, use_whitelist, &has_ascii);
+		if (!size) {
+			smart_str_free(&escaped_str);
+			RETURN_FALSE;
+		}
+		i += size;
+	}
+
+	if (!has_ascii) {
+		smart_str_free(&escaped_str);
+		RETURN_FALSE;
+	}
+
+	smart_str_0(&escaped_str);
+
+#if PHP_VERSION_ID < 70000
+	RETURN_STRINGL(escaped_str.c, escaped_str.len, 0);
+#else
+	RETURN_STR(escaped_str.s);
+#endif
+}
+
+/**
+ * Escapes non-alphanumeric characters to \HH+
+ */
+void phalcon_escape_css_utf8(zval *return_value, zval *param)
+{
+	phalcon_escape_utf8(return_value, param, "\\", sizeof("\\")-1, ' ', 0);
+}
+
+/**
+ * Escapes non-alphanumeric characters to \xHH+
+ */
+void phalcon_escape_js_utf8(zval *return_value, zval *param)
+{
+	phalcon_escape_utf8(return_value, param, "\\x", sizeof("\\x")-1, '\0', 1);
+}
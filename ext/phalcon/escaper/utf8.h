@@ -0,0 +1,29 @@
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2018 Phalcon Team (https://phalconphp.com)          |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+#ifndef PHALCON_ESCAPER_UTF8_H
+#define PHALCON_ESCAPER_UTF8_H
+
+#include <Zend/zend.h>
+
+/* Escapes UTF-8 strings without converting them to UTF-32 */
+void phalcon_escape_utf8(zval *return_value, zval *param, const char *escape_char, unsigned int escape_length, char escape_extra, int use_whitelist);
+void phalcon_escape_css_utf8(zval *return_value, zval *param);
+void phalcon_escape_js_utf8(zval *return_value, zval *param);
+
+#endif /* PHALCON_ESCAPER_UTF8_H */
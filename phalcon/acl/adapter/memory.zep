@@ -162,6 +162,20 @@ class Memory extends Adapter
 	 */
 	protected _noArgumentsDefaultAction = Acl::ALLOW;
 
+	/**
+	 * Access decisions resolved by compile(), indexed by role!resource!access
+	 *
+	 * @var array|null
+	 */
+	protected _compiledAccess;
+
+	/**
+	 * Functions resolved by compile(), indexed by role!resource!access
+	 *
+	 * @var array
+	 */
+	protected _compiledFunc = [];
+
 	/**
 	 * Phalcon\Acl\Adapter\Memory constructor
 	 */
@@ -207,6 +221,7 @@ class Memory extends Adapter
 
 		let this->_roles[] = roleObject;
 		let this->_rolesNames[roleName] = true;
+		let this->_compiledAccess = null;
 
 		if accessInherits != null {
 			return this->addInherit(roleName, accessInherits);
@@ -257,6 +272,8 @@ class Memory extends Adapter
 			let this->_roleInherits[roleName] = true;
 		}
 
+		let this->_compiledAccess = null;
+
 		let this->_roleInherits[roleName][] = roleInheritName;
 
 		return true;
@@ -352,6 +369,8 @@ class Memory extends Adapter
 			throw new Exception("Invalid value for accessList");
 		}
 
+		let this->_compiledAccess = null;
+
 		let exists = true;
 		if typeof accessList == "array" {
 			for accessName in accessList {
@@ -379,6 +398,8 @@ class Memory extends Adapter
 	{
 		var accessName, accessKey;
 
+		let this->_compiledAccess = null;
+
 		if typeof accessList == "array" {
 			for accessName in accessList {
 				let accessKey = resourceName . "!" . accessName;
@@ -411,7 +432,8 @@ class Memory extends Adapter
 			throw new Exception("Resource '" . resourceName . "' does not exist in ACL");
 		}
 
-		let accessList = this->_accessList;
+		let accessList = this->_accessList,
+			this->_compiledAccess = null;
 
 		if typeof access == "array" {
 
@@ -535,9 +557,8 @@ class Memory extends Adapter
 	 */
 	public function isAllowed(var roleName, var resourceName, string access, array parameters = null) -> boolean
 	{
-		var eventsManager, accessList, accessKey,
-			haveAccess = null, roleInherits, inheritedRole, rolesNames,
-			inheritedRoles, funcAccess = null, resourceObject = null, roleObject = null, funcList,
+		var eventsManager, accessKey, compiledAccess, decision,
+			haveAccess = null, rolesNames, funcAccess = null, resourceObject = null, roleObject = null,
 			reflectionFunction, reflectionParameters, parameterNumber, parametersForFunction,
 			numberOfRequiredParameters, userParametersSizeShouldBe, reflectionClass, parameterToCheck,
 			reflectionParameter, hasRole = false, hasResource = false;
@@ -568,9 +589,7 @@ class Memory extends Adapter
 		let this->_activeRole = roleName;
 		let this->_activeResource = resourceName;
 		let this->_activeAccess = access;
-		let accessList = this->_access;
 		let eventsManager = <EventsManager> this->_eventsManager;
-		let funcList = this->_func;
 
 		if typeof eventsManager == "object" {
 			if eventsManager->fire("acl:beforeCheckAccess", this) === false {
@@ -586,100 +605,33 @@ class Memory extends Adapter
 			return (this->_defaultAccess == Acl::ALLOW);
 		}
 
-		let accessKey = roleName . "!" . resourceName . "!" . access;
-
-		/**
-		 * Check if there is a direct combination for role-resource-access
-		 */
-		if isset accessList[accessKey] {
-			let haveAccess = accessList[accessKey];
-		}
-
-		fetch funcAccess, funcList[accessKey];
-
-		/**
-		 * Check in the inherits roles
-		 */
-		if haveAccess == null {
-
-			let roleInherits = this->_roleInherits;
-			if fetch inheritedRoles, roleInherits[roleName] {
-				if typeof inheritedRoles == "array" {
-					for inheritedRole in inheritedRoles {
-						let accessKey = inheritedRole . "!" . resourceName . "!" . access;
-
-						/**
-						 * Check if there is a direct combination in one of the inherited roles
-						 */
-						if isset accessList[accessKey] {
-							let haveAccess = accessList[accessKey];
-						}
-						fetch funcAccess, funcList[accessKey];
-					}
-				}
-			}
-		}
-
-		/**
-		 * If access wasn't found yet, try role-resource-*
-		 */
-		if haveAccess == null {
-
-			let accessKey =  roleName . "!" . resourceName . "!*";
+		let compiledAccess = this->_compiledAccess;
+		if typeof compiledAccess == "array" {
 
 			/**
-			 * In the direct role
+			 * The decision was resolved by compile(), falling back to the
+			 * decisions compiled for any access and for any resource
 			 */
-			if isset accessList[accessKey] {
-				let haveAccess = accessList[accessKey];
-				fetch funcAccess, funcList[accessKey];
-			} else {
-				if typeof inheritedRoles == "array" {
-					for inheritedRole in inheritedRoles {
-						let accessKey = inheritedRole . "!" . resourceName . "!*";
-
-						/**
-						 * In the inherited roles
-						 */
-						fetch funcAccess, funcList[accessKey];
-						if isset accessList[accessKey] {
-							let haveAccess = accessList[accessKey];
-							break;
-						}
+			let accessKey = roleName . "!" . resourceName . "!" . access;
+			if !fetch haveAccess, compiledAccess[accessKey] {
+				let accessKey = roleName . "!" . resourceName . "!*";
+				if !fetch haveAccess, compiledAccess[accessKey] {
+					let accessKey = roleName . "!*!*";
+					if !fetch haveAccess, compiledAccess[accessKey] {
+						let haveAccess = -1;
 					}
 				}
 			}
-		}
-
-		/**
-		 * If access wasn't found yet, try role-*-*
-		 */
-		if haveAccess == null {
 
-			let accessKey =  roleName . "!*!*";
-
-			/**
-			 * Try in the direct role
-			 */
-			if isset accessList[accessKey] {
-				let haveAccess = accessList[accessKey];
-				fetch funcAccess, funcList[accessKey];
-			} else {
-				if typeof inheritedRoles == "array" {
-					for inheritedRole in inheritedRoles {
-						let accessKey = inheritedRole . "!*!*";
-
-						/**
-						 * In the inherited roles
-						 */
-						fetch funcAccess, funcList[accessKey];
-						if isset accessList[accessKey] {
-							let haveAccess = accessList[accessKey];
-							break;
-						}
-					}
-				}
+			if haveAccess == -1 {
+				let haveAccess = null;
 			}
+
+			fetch funcAccess, this->_compiledFunc[accessKey];
+		} else {
+			let decision = this->_resolveAccess(roleName, resourceName, access),
+				haveAccess = decision[0],
+				funcAccess = decision[1];
 		}
 
 		let this->_accessGranted = haveAccess;
@@ -780,6 +732,236 @@ class Memory extends Adapter
 		return haveAccess == Acl::ALLOW;
 	}
 
+	/**
+	 * Compiles the access lists resolving the inherited roles and the wildcards
+	 * of every combination of role, resource and access, so isAllowed() only
+	 * has to look up the decision. Any change made to the ACL discards it
+	 *
+	 * <code>
+	 * $acl->compile();
+	 *
+	 * $acl->isAllowed("guests", "customers", "search");
+	 * </code>
+	 */
+	public function compile() -> <Memory>
+	{
+		var compiledAccess, compiledFunc, roleName, resourceName, accessKey, accessParts, decision;
+
+		let compiledAccess = [],
+			compiledFunc = [];
+
+		for roleName, _ in this->_rolesNames {
+
+			/**
+			 * Every access declared in the resources
+			 */
+			for accessKey, _ in this->_accessList {
+				let accessParts = explode("!", accessKey, 2),
+					decision = this->_resolveAccess(roleName, accessParts[0], accessParts[1]),
+					accessKey = roleName . "!" . accessKey;
+
+				let compiledAccess[accessKey] = decision[0] === null ? -1 : (int) decision[0];
+				if decision[1] !== null {
+					let compiledFunc[accessKey] = decision[1];
+				}
+			}
+
+			/**
+			 * Any other access of every resource, including any resource
+			 */
+			for resourceName, _ in this->_resourcesNames {
+				let decision = this->_resolveAccess(roleName, resourceName, "*"),
+					accessKey = roleName . "!" . resourceName . "!*";
+
+				let compiledAccess[accessKey] = decision[0] === null ? -1 : (int) decision[0];
+				if decision[1] !== null {
+					let compiledFunc[accessKey] = decision[1];
+				}
+			}
+		}
+
+		let this->_compiledAccess = compiledAccess,
+			this->_compiledFunc = compiledFunc;
+
+		return this;
+	}
+
+	/**
+	 * Checks whether the access lists are compiled
+	 */
+	public function isCompiled() -> boolean
+	{
+		return typeof this->_compiledAccess == "array";
+	}
+
+	/**
+	 * Exports the compiled access lists to a string that can be stored in a
+	 * cache and loaded by loadCompiled() without rebuilding the ACL
+	 *
+	 * <code>
+	 * apcu_store("acl", $acl->compile()->exportCompiled());
+	 * </code>
+	 */
+	public function exportCompiled() -> string
+	{
+		if typeof this->_compiledAccess != "array" {
+			throw new Exception("The access lists must be compiled before being exported");
+		}
+
+		if count(this->_compiledFunc) {
+			throw new Exception("Access lists with functions can't be exported");
+		}
+
+		return serialize([
+			"roles":         array_keys(this->_rolesNames),
+			"defaultAccess": this->_defaultAccess,
+			"access":        this->_compiledAccess
+		]);
+	}
+
+	/**
+	 * Loads access lists exported by exportCompiled(). The loaded access lists
+	 * can only be checked, any change to them discards the compiled decisions
+	 *
+	 * <code>
+	 * $acl = new \Phalcon\Acl\Adapter\Memory();
+	 *
+	 * $acl->loadCompiled(
+	 *     apcu_fetch("acl")
+	 * );
+	 * </code>
+	 */
+	public function loadCompiled(string! compiled) -> <Memory>
+	{
+		var data, roles, defaultAccess, compiledAccess;
+
+		let data = unserialize(compiled);
+
+		if typeof data != "array" || !fetch roles, data["roles"] || !fetch defaultAccess, data["defaultAccess"] || !fetch compiledAccess, data["access"] {
+			throw new Exception("Invalid compiled access lists");
+		}
+
+		let this->_rolesNames = array_fill_keys(roles, true),
+			this->_defaultAccess = defaultAccess,
+			this->_compiledAccess = compiledAccess,
+			this->_compiledFunc = [];
+
+		return this;
+	}
+
+	/**
+	 * Resolves the access action and function of a combination of role,
+	 * resource and access walking the inherited roles and the wildcards
+	 *
+	 * @return array
+	 */
+	protected function _resolveAccess(string roleName, string resourceName, string access) -> array
+	{
+		var accessList, accessKey, haveAccess = null, roleInherits, inheritedRole,
+			inheritedRoles, funcAccess = null, funcList;
+
+		let accessList = this->_access,
+			funcList = this->_func;
+
+		let accessKey = roleName . "!" . resourceName . "!" . access;
+
+		/**
+		 * Check if there is a direct combination for role-resource-access
+		 */
+		if isset accessList[accessKey] {
+			let haveAccess = accessList[accessKey];
+		}
+
+		fetch funcAccess, funcList[accessKey];
+
+		/**
+		 * Check in the inherits roles
+		 */
+		if haveAccess == null {
+
+			let roleInherits = this->_roleInherits;
+			if fetch inheritedRoles, roleInherits[roleName] {
+				if typeof inheritedRoles == "array" {
+					for inheritedRole in inheritedRoles {
+						let accessKey = inheritedRole . "!" . resourceName . "!" . access;
+
+						/**
+						 * Check if there is a direct combination in one of the inherited roles
+						 */
+						if isset accessList[accessKey] {
+							let haveAccess = accessList[accessKey];
+						}
+						fetch funcAccess, funcList[accessKey];
+					}
+				}
+			}
+		}
+
+		/**
+		 * If access wasn't found yet, try role-resource-*
+		 */
+		if haveAccess == null {
+
+			let accessKey =  roleName . "!" . resourceName . "!*";
+
+			/**
+			 * In the direct role
+			 */
+			if isset accessList[accessKey] {
+				let haveAccess = accessList[accessKey];
+				fetch funcAccess, funcList[accessKey];
+			} else {
+				if typeof inheritedRoles == "array" {
+					for inheritedRole in inheritedRoles {
+						let accessKey = inheritedRole . "!" . resourceName . "!*";
+
+						/**
+						 * In the inherited roles
+						 */
+						fetch funcAccess, funcList[accessKey];
+						if isset accessList[accessKey] {
+							let haveAccess = accessList[accessKey];
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		/**
+		 * If access wasn't found yet, try role-*-*
+		 */
+		if haveAccess == null {
+
+			let accessKey =  roleName . "!*!*";
+
+			/**
+			 * Try in the direct role
+			 */
+			if isset accessList[accessKey] {
+				let haveAccess = accessList[accessKey];
+				fetch funcAccess, funcList[accessKey];
+			} else {
+				if typeof inheritedRoles == "array" {
+					for inheritedRole in inheritedRoles {
+						let accessKey = inheritedRole . "!*!*";
+
+						/**
+						 * In the inherited roles
+						 */
+						fetch funcAccess, funcList[accessKey];
+						if isset accessList[accessKey] {
+							let haveAccess = accessList[accessKey];
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		return [haveAccess, funcAccess];
+	}
+
 	/**
 	 * Sets the default access level (Phalcon\Acl::ALLOW or Phalcon\Acl::DENY)
 	 * for no arguments provided in isAllowed action if there exists func for
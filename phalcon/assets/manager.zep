@@ -46,6 +46,8 @@ class Manager
 
 	protected _implicitOutput = true;
 
+	protected _manifest;
+
 	/**
 	 * Phalcon\Assets\Manager
 	 *
@@ -777,7 +779,12 @@ class Manager
 	 */
 	public function outputCss(collectionName = null) -> string
 	{
-		var collection;
+		var collection, html;
+
+		let html = this->outputManifest(collectionName ? collectionName : "css", "css", ["Phalcon\\Tag", "stylesheetLink"]);
+		if html !== null {
+			return html;
+		}
 
 		if !collectionName {
 			let collection = this->getCss();
@@ -813,7 +820,12 @@ class Manager
 	 */
 	public function outputJs(collectionName = null) -> string
 	{
-		var collection;
+		var collection, html;
+
+		let html = this->outputManifest(collectionName ? collectionName : "js", "js", ["Phalcon\\Tag", "javascriptInclude"]);
+		if html !== null {
+			return html;
+		}
 
 		if !collectionName {
 			let collection = this->getJs();
@@ -842,6 +854,89 @@ class Manager
 		return this->outputInline(collection, "script");
 	}
 
+	/**
+	 * Joins, filters and writes the local resources of every collection to
+	 * a bundle named after the hash of its content and returns a manifest
+	 * with the HTML tags to output. This is meant to run when deploying the
+	 * application, the manifest can be stored in a PHP file and set with
+	 * setManifest() so outputCss() and outputJs() don't access the
+	 * filesystem
+	 *
+	 *<code>
+	 * $assets
+	 *     ->collection("header")
+	 *     ->addCss("css/bootstrap.css")
+	 *     ->addCss("css/style.css")
+	 *     ->setTargetPath("public/production/header.css")
+	 *     ->setTargetUri("production/header.css")
+	 *     ->addFilter(new Cssmin());
+	 *
+	 * // Writes public/production/header.{hash}.css and its gzip version
+	 * $assets->build("app/cache/assets.php", ["gz"]);
+	 *</code>
+	 */
+	public function build(string! manifestPath = null, array! compress = []) -> array
+	{
+		var manifest, collections, name, collection, type, tags, tmpFile;
+
+		let manifest = [],
+			collections = this->_collections;
+
+		if typeof collections == "array" {
+			for name, collection in collections {
+				for type in ["css", "js"] {
+					let tags = this->buildCollection(name, collection, type, compress);
+					if count(tags) {
+						let manifest[name][type] = tags;
+					}
+				}
+			}
+		}
+
+		if manifestPath !== null {
+			/**
+			 * The manifest is replaced atomically
+			 */
+			let tmpFile = manifestPath . "." . uniqid("", true) . ".tmp";
+
+			if file_put_contents(tmpFile, "<?php return " . var_export(manifest, true) . ";") === false {
+				throw new Exception("Assets manifest '" . manifestPath . "' could not be written");
+			}
+
+			if !rename(tmpFile, manifestPath) {
+				unlink(tmpFile);
+				throw new Exception("Assets manifest '" . manifestPath . "' could not be written");
+			}
+		}
+
+		let this->_manifest = manifest;
+
+		return manifest;
+	}
+
+	/**
+	 * Sets the manifest generated by build(), the tags of the collections
+	 * found in it are generated without accessing the resources
+	 *
+	 *<code>
+	 * $assets->setManifest(require "app/cache/assets.php");
+	 *</code>
+	 */
+	public function setManifest(array! manifest) -> <Manager>
+	{
+		let this->_manifest = manifest;
+
+		return this;
+	}
+
+	/**
+	 * Returns the manifest used to output the collections
+	 */
+	public function getManifest() -> array | null
+	{
+		return this->_manifest;
+	}
+
 	/**
 	 * Returns existing collections in the manager
 	 */
@@ -850,6 +945,187 @@ class Manager
 		return this->_collections;
 	}
 
+	/**
+	 * Writes the bundle of a collection for a type of resources and returns
+	 * the tags to output it, the remote resources keep their own tag
+	 */
+	protected function buildCollection(string! name, <Collection> collection, string! type, array! compress) -> array
+	{
+		var resources, filters, options, sourceBasePath = null, targetBasePath = null,
+			collectionSourcePath, completeSourcePath, collectionTargetPath,
+			completeTargetPath, prefix, tags, $resource, content, filter, joinedContent,
+			bundlePosition, hash, targetPath, targetUri, extension;
+
+		let resources = this->collectionResourcesByType(collection->getResources(), type);
+
+		if !count(resources) {
+			return [];
+		}
+
+		let options = this->_options;
+		if typeof options == "array" {
+			fetch sourceBasePath, options["sourceBasePath"];
+			fetch targetBasePath, options["targetBasePath"];
+		}
+
+		let collectionSourcePath = collection->getSourcePath();
+		if collectionSourcePath {
+			let completeSourcePath = sourceBasePath . collectionSourcePath;
+		} else {
+			let completeSourcePath = sourceBasePath;
+		}
+
+		let collectionTargetPath = collection->getTargetPath();
+		if collectionTargetPath {
+			let completeTargetPath = targetBasePath . collectionTargetPath;
+		} else {
+			let completeTargetPath = targetBasePath;
+		}
+
+		let prefix = collection->getPrefix(),
+			filters = collection->getFilters(),
+			tags = [],
+			joinedContent = "",
+			bundlePosition = null;
+
+		for $resource in resources {
+
+			if !$resource->getLocal() {
+				let tags[] = [
+					"path":       prefix . $resource->getRealTargetUri(),
+					"local":      false,
+					"attributes": $resource->getAttributes()
+				];
+				continue;
+			}
+
+			/**
+			 * The bundle is output where its first resource is
+			 */
+			if bundlePosition === null {
+				let bundlePosition = count(tags),
+					tags[] = null;
+			}
+
+			let content = $resource->getContent(completeSourcePath);
+
+			if $resource->getFilter() {
+				for filter in filters {
+					if typeof filter != "object" {
+						throw new Exception("Filter is invalid");
+					}
+
+					let content = filter->filter(content);
+				}
+			}
+
+			if type == "js" {
+				let joinedContent .= content . ";\n";
+			} else {
+				let joinedContent .= content . "\n";
+			}
+		}
+
+		if bundlePosition === null {
+			return tags;
+		}
+
+		let targetUri = collection->getTargetUri();
+
+		if !completeTargetPath || is_dir(completeTargetPath) || !targetUri {
+			throw new Exception("Collection '" . name . "' needs a target path and a target uri to be built");
+		}
+
+		/**
+		 * The hash of the content is added before the extension
+		 */
+		let hash = substr(md5(joinedContent), 0, 16),
+			extension = pathinfo(completeTargetPath, PATHINFO_EXTENSION);
+
+		if extension {
+			let targetPath = substr(completeTargetPath, 0, -strlen(extension) - 1) . "." . hash . "." . extension,
+				targetUri = substr(targetUri, 0, -strlen(extension) - 1) . "." . hash . "." . extension;
+		} else {
+			let targetPath = completeTargetPath . "." . hash,
+				targetUri = targetUri . "." . hash;
+		}
+
+		if file_put_contents(targetPath, joinedContent) === false {
+			throw new Exception("Bundle '" . targetPath . "' could not be written");
+		}
+
+		/**
+		 * Precompressed siblings can be served directly by the web server
+		 */
+		if in_array("gz", compress) {
+			file_put_contents(targetPath . ".gz", gzencode(joinedContent, 9));
+		}
+
+		if in_array("br", compress) && function_exists("brotli_compress") {
+			file_put_contents(targetPath . ".br", call_user_func("brotli_compress", joinedContent));
+		}
+
+		let tags[bundlePosition] = [
+			"path":       prefix . targetUri,
+			"local":      collection->getTargetLocal(),
+			"attributes": collection->getAttributes()
+		];
+
+		return tags;
+	}
+
+	/**
+	 * Generates the HTML of a collection from the manifest, returns null if
+	 * the collection is not found in it
+	 */
+	protected function outputManifest(string! name, string! type, callback) -> string | null
+	{
+		var manifest, collection, tags, tag, attributes, parameters, html, output;
+
+		let manifest = this->_manifest;
+
+		if typeof manifest != "array" {
+			return null;
+		}
+
+		if !fetch collection, manifest[name] {
+			return null;
+		}
+
+		if !fetch tags, collection[type] {
+			return null;
+		}
+
+		let output = "";
+
+		for tag in tags {
+
+			let attributes = tag["attributes"],
+				parameters = [];
+
+			if typeof attributes == "array" {
+				let attributes[0] = tag["path"];
+				let parameters[] = attributes;
+			} else {
+				let parameters[] = tag["path"];
+			}
+			let parameters[] = tag["local"];
+
+			let html = call_user_func_array(callback, parameters);
+
+			/**
+			 * Implicit output prints the content directly
+			 */
+			if this->_implicitOutput == true {
+				echo html;
+			} else {
+				let output .= html;
+			}
+		}
+
+		return output;
+	}
+
 	/**
 	 * Returns true or false if collection exists.
 	 *
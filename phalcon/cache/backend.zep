@@ -43,6 +43,10 @@ abstract class Backend implements BackendInterface
 
 	protected _started = false;
 
+	protected _startedKey = null;
+
+	protected _computing = [];
+
 	/**
 	 * Phalcon\Cache\Backend constructor
 	 *
@@ -76,9 +80,14 @@ abstract class Backend implements BackendInterface
 		var existingCache, fresh;
 
 		/**
-		 * Get the cache content verifying if it was expired
+		 * Get the cache content verifying if it was expired, only one process
+		 * computes it if the stampede protection is enabled
 		 */
-		let existingCache = this->{"get"}(keyName, lifetime);
+		if this->_protectsComputing() {
+			let existingCache = this->fetchOrLock((string) keyName, lifetime);
+		} else {
+			let existingCache = this->{"get"}(keyName, lifetime);
+		}
 
 		if existingCache === null {
 			let fresh = true;
@@ -88,7 +97,8 @@ abstract class Backend implements BackendInterface
 		}
 
 		let this->_fresh = fresh,
-			this->_started = true;
+			this->_started = true,
+			this->_startedKey = keyName;
 
 		/**
 		 * Update the last lifetime to be used in save()
@@ -108,6 +118,11 @@ abstract class Backend implements BackendInterface
 		if stopBuffer === true {
 			this->_frontend->stop();
 		}
+
+		if this->_startedKey !== null {
+			this->abortCompute((string) this->_startedKey);
+		}
+
 		let this->_started = false;
 	}
 
@@ -127,6 +142,378 @@ abstract class Backend implements BackendInterface
 		return this->_started;
 	}
 
+	/**
+	 * Returns the cached contents of several keys, the keys not found in
+	 * the cache are returned with a null value
+	 *
+	 * <code>
+	 * $values = $cache->getMultiple(["my-key", "other-key"]);
+	 * </code>
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var keyName, values;
+
+		let values = [];
+		for keyName in keyNames {
+			let values[keyName] = this->{"get"}(keyName, lifetime);
+		}
+
+		return values;
+	}
+
+	/**
+	 * Stores several contents into the cache, the backends able to do it
+	 * store all of them in a single operation
+	 *
+	 * <code>
+	 * $cache->saveMultiple(
+	 *     [
+	 *         "my-key"    => $data,
+	 *         "other-key" => $otherData,
+	 *     ],
+	 *     3600
+	 * );
+	 * </code>
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function saveMultiple(array! values, lifetime = null) -> boolean
+	{
+		var keyName, content;
+
+		for keyName, content in values {
+			this->{"save"}(keyName, content, lifetime, false);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several values from the cache, returns true if all of them
+	 * were deleted
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function deleteMultiple(array! keyNames) -> boolean
+	{
+		var keyName;
+		boolean success;
+
+		let success = true;
+		for keyName in keyNames {
+			if !this->{"delete"}(keyName) {
+				let success = false;
+			}
+		}
+
+		return success;
+	}
+
+	/**
+	 * Returns the cached content or stores the value returned by the
+	 * callable if it is missing or expired
+	 *
+	 * Several backend options help to avoid many processes computing the
+	 * same expired key at the same time:
+	 *
+	 * - earlyExpiration: recomputes the value before it expires with a
+	 *   probability that grows as the expiration gets closer and with the
+	 *   time spent computing it, 1.0 is a sensible value
+	 * - staleLifetime: seconds the value is kept after it expires. The File
+	 *   backend expires the files by their age, the lifetime plus the stale
+	 *   lifetime is passed to get() so it keeps the stale values as well
+	 * - lockLifetime: only the process getting the lock computes a missing
+	 *   or expired value. The others get the stale value meanwhile or, if
+	 *   there is none, wait up to the lock lifetime for the value
+	 *
+	 * The same protection applies to start() when any of these options is
+	 * set, for example to the views cached by Phalcon\Mvc\View::cache(),
+	 * and to the resultsets cached by Phalcon\Mvc\Model\Query::cache()
+	 *
+	 * <code>
+	 * $cache = new Redis(
+	 *     $frontCache,
+	 *     [
+	 *         "staleLifetime" => 60,
+	 *         "lockLifetime"  => 10,
+	 *     ]
+	 * );
+	 *
+	 * $robots = $cache->getOrCompute(
+	 *     "robots",
+	 *     function () {
+	 *         return Robots::find()->toArray();
+	 *     },
+	 *     3600
+	 * );
+	 * </code>
+	 */
+	public function getOrCompute(string! keyName, callable computer, lifetime = null)
+	{
+		var content, e;
+
+		let content = this->fetchOrLock(keyName, lifetime);
+		if content !== null {
+			return content;
+		}
+
+		/**
+		 * \Exception is checked first so PHP 5 never looks \Throwable up
+		 */
+		try {
+			let content = call_user_func(computer, keyName);
+		} catch \Exception|\Throwable, e {
+			this->abortCompute(keyName);
+			throw e;
+		}
+
+		this->saveComputed(keyName, content, lifetime, false);
+
+		return content;
+	}
+
+	/**
+	 * Returns the cached content unless it must be computed, in that case
+	 * null is returned and the content must be stored with saveComputed()
+	 * or the computation abandoned with abortCompute(). An expired content
+	 * is returned while another process holds the lock to compute it
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function fetchOrLock(string! keyName, lifetime = null)
+	{
+		var options, earlyExpiration, lockLifetime, metaKey, lockKey, values,
+			content, meta, parts, expiration, delta, now, deadline;
+		boolean locked;
+
+		let options = this->_options;
+
+		if !fetch earlyExpiration, options["earlyExpiration"] {
+			let earlyExpiration = 0;
+		}
+
+		if !fetch lockLifetime, options["lockLifetime"] {
+			let lockLifetime = 0;
+		}
+
+		let lifetime = this->_getComputedLifetime(lifetime),
+			metaKey = keyName . "_PHMT",
+			lockKey = keyName . "_PHLK",
+			locked = false;
+
+		let values = this->getMultiple([keyName, metaKey], lifetime[1]),
+			content = values[keyName],
+			meta = values[metaKey];
+
+		if content !== null {
+
+			/**
+			 * Values stored without expiration details never expire early
+			 */
+			if typeof meta != "string" || !memstr(meta, "|") {
+				return content;
+			}
+
+			let parts = explode("|", meta),
+				expiration = (double) parts[0],
+				delta = (double) parts[1],
+				now = microtime(true);
+
+			if expiration <= 0 {
+				return content;
+			}
+
+			if earlyExpiration > 0 {
+				/**
+				 * Probabilistic early expiration (XFetch)
+				 */
+				let now = now - delta * earlyExpiration * log(mt_rand(1, mt_getrandmax()) / mt_getrandmax());
+			}
+
+			if now < expiration {
+				return content;
+			}
+
+			if lockLifetime > 0 {
+				if !this->_acquireLock(lockKey, lockLifetime) {
+					return content;
+				}
+
+				let locked = true;
+			}
+
+		} elseif lockLifetime > 0 {
+
+			/**
+			 * Without a stale value the processes not getting the lock wait
+			 * for the content, it's computed anyway once the lock expires
+			 */
+			let deadline = microtime(true) + lockLifetime;
+
+			loop {
+				if this->_acquireLock(lockKey, lockLifetime) {
+					let locked = true;
+					break;
+				}
+
+				if microtime(true) >= deadline {
+					break;
+				}
+
+				usleep(50000);
+
+				let content = this->{"get"}(keyName, lifetime[1]);
+				if content !== null {
+					return content;
+				}
+			}
+		}
+
+		let this->_computing[keyName] = [locked, microtime(true)];
+
+		return null;
+	}
+
+	/**
+	 * Stores the content computed after fetchOrLock() returned null with the
+	 * details used to expire it early and releases the lock. Without a key
+	 * the content buffered since start() is stored
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function saveComputed(var keyName = null, var content = null, lifetime = null, boolean stopBuffer = true) -> boolean
+	{
+		var computing, now, expiration, values, metaKey;
+		boolean status;
+
+		if keyName === null {
+			let keyName = (string) this->_startedKey;
+			if lifetime === null {
+				let lifetime = this->_lastLifetime;
+			}
+		}
+
+		/**
+		 * Without any protection there are no details to store
+		 */
+		if !this->_protectsComputing() {
+			let status = (bool) this->{"save"}(keyName, content, lifetime, stopBuffer);
+			this->abortCompute(keyName);
+			return status;
+		}
+
+		if !fetch computing, this->_computing[keyName] {
+			let computing = [false, microtime(true)];
+		}
+
+		let now = microtime(true),
+			lifetime = this->_getComputedLifetime(lifetime),
+			metaKey = keyName . "_PHMT";
+
+		if lifetime[0] >= 1 {
+			let expiration = now + lifetime[0];
+		} else {
+			let expiration = 0;
+		}
+
+		if content === null {
+			/**
+			 * Store the content buffered by the frontend
+			 */
+			let status = (bool) this->{"save"}(keyName, null, lifetime[1], stopBuffer);
+			if status {
+				this->{"save"}(metaKey, expiration . "|" . (now - computing[1]), lifetime[1], false);
+			}
+		} else {
+			let values = [];
+			let values[keyName] = content,
+				values[metaKey] = expiration . "|" . (now - computing[1]);
+
+			let status = this->saveMultiple(values, lifetime[1]);
+		}
+
+		this->abortCompute(keyName);
+
+		return status;
+	}
+
+	/**
+	 * Releases the lock taken by fetchOrLock() without storing any content
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function abortCompute(string! keyName) -> void
+	{
+		var computing;
+
+		if fetch computing, this->_computing[keyName] {
+			unset this->_computing[keyName];
+
+			if computing[0] {
+				this->_releaseLock(keyName . "_PHLK");
+			}
+		}
+	}
+
+	/**
+	 * Checks whether any option protecting the computed contents is set
+	 */
+	protected function _protectsComputing() -> boolean
+	{
+		var options;
+
+		let options = this->_options;
+
+		return !empty options["earlyExpiration"] || !empty options["staleLifetime"] || !empty options["lockLifetime"];
+	}
+
+	/**
+	 * Returns the lifetime of a computed content and the lifetime it is
+	 * stored for, which includes the stale lifetime
+	 */
+	protected function _getComputedLifetime(lifetime) -> array
+	{
+		var staleLifetime;
+
+		if lifetime === null {
+			let lifetime = this->_frontend->getLifetime();
+		}
+
+		if !fetch staleLifetime, this->_options["staleLifetime"] {
+			let staleLifetime = 0;
+		}
+
+		if lifetime >= 1 {
+			return [lifetime, lifetime + staleLifetime];
+		}
+
+		return [lifetime, lifetime];
+	}
+
+	/**
+	 * Takes the lock used to recompute an expired key. The backends able to
+	 * do it atomically override this method
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		if this->{"exists"}(lockKey, lifetime) {
+			return false;
+		}
+
+		return (bool) this->{"save"}(lockKey, "lock", lifetime, false);
+	}
+
+	/**
+	 * Releases the lock used to recompute an expired key
+	 */
+	protected function _releaseLock(string! lockKey) -> void
+	{
+		this->{"delete"}(lockKey);
+	}
+
 	/**
 	 * Gets the last lifetime set
 	 *
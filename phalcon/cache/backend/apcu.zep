@@ -185,6 +185,124 @@ class Apcu extends Backend
 		return apcu_delete("_PHCA" . this->_prefix . keyName);
 	}
 
+	/**
+	 * Returns the cached contents of several keys with a single apcu_fetch
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var frontend, prefix, keyName, prefixedKeys, cachedContents,
+			cachedContent, values;
+
+		let frontend = this->_frontend,
+			prefix = "_PHCA" . this->_prefix,
+			prefixedKeys = [],
+			values = [];
+
+		if !count(keyNames) {
+			return values;
+		}
+
+		for keyName in keyNames {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let cachedContents = apcu_fetch(prefixedKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		for keyName in keyNames {
+			if !fetch cachedContent, cachedContents[prefix . keyName] || cachedContent === false {
+				let values[keyName] = null;
+			} else {
+				let values[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return values;
+	}
+
+	/**
+	 * Stores several contents with a single apcu_store
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function saveMultiple(array! values, lifetime = null) -> boolean
+	{
+		var frontend, prefix, ttl, keyName, content, items, failed;
+
+		let frontend = this->_frontend,
+			prefix = "_PHCA" . this->_prefix,
+			items = [];
+
+		if lifetime === null {
+			let ttl = this->_lastLifetime;
+			if ttl === null {
+				let ttl = frontend->getLifetime();
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		for keyName, content in values {
+			if !is_numeric(content) {
+				let content = frontend->beforeStore(content);
+			}
+
+			let items[prefix . keyName] = content;
+		}
+
+		if !count(items) {
+			return true;
+		}
+
+		/**
+		 * An array with the keys that could not be stored is returned
+		 */
+		let failed = apcu_store(items, null, ttl);
+
+		if typeof failed != "array" || count(failed) {
+			throw new Exception("Failed storing data in APCu");
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys with a single apcu_delete
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function deleteMultiple(array! keyNames) -> boolean
+	{
+		var prefix, keyName, prefixedKeys, failed;
+
+		if !count(keyNames) {
+			return true;
+		}
+
+		let prefix = "_PHCA" . this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keyNames {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let failed = apcu_delete(prefixedKeys);
+
+		return typeof failed == "array" && !count(failed);
+	}
+
+	/**
+	 * Takes the lock used to recompute an expired key with apcu_add
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		return apcu_add("_PHCA" . this->_prefix . lockKey, "lock", lifetime);
+	}
+
 	/**
 	 * Query the existing cached keys.
 	 *
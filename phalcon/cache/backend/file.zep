@@ -58,6 +58,20 @@ use Phalcon\Cache\FrontendInterface;
  *     echo $content;
  * }
  *</code>
+ *
+ * Large caches can spread the files in hashed subdirectories, "ab/cd/" for
+ * two levels. The keys are then recorded in an index so queryKeys() does
+ * not traverse the directories
+ *
+ *<code>
+ * $cache = new File(
+ *     $frontCache,
+ *     [
+ *         "cacheDir"    => "../app/cache/",
+ *         "shardLevels" => 2,
+ *     ]
+ * );
+ *</code>
  */
 class File extends Backend
 {
@@ -68,17 +82,32 @@ class File extends Backend
 	 */
 	private _useSafeKey = false;
 
+	/**
+	 * Number of hashed subdirectory levels
+	 *
+	 * @var int
+	 */
+	protected _shardLevels = 0;
+
 	/**
 	 * Phalcon\Cache\Backend\File constructor
 	 */
 	public function __construct(<FrontendInterface> frontend, array options)
 	{
-		var prefix, safekey;
+		var prefix, safekey, shardLevels;
 
 		if !isset options["cacheDir"] {
 			throw new Exception("Cache directory must be specified with the option cacheDir");
 		}
 
+		if fetch shardLevels, options["shardLevels"] {
+			if typeof shardLevels != "integer" || shardLevels < 0 || shardLevels > 16 {
+				throw new Exception("shardLevels option should be an integer between 0 and 16.");
+			}
+
+			let this->_shardLevels = shardLevels;
+		}
+
 		if fetch safekey, options["safekey"] {
 			if typeof safekey !== "boolean" {
 				throw new Exception("safekey option should be a boolean.");
@@ -102,16 +131,12 @@ class File extends Backend
 	 */
 	public function get(string keyName, int lifetime = null) -> var | null
 	{
-		var prefixedKey, cacheDir, cacheFile, frontend, lastLifetime, ttl, cachedContent, ret, modifiedTime;
+		var prefixedKey, cacheFile, frontend, lastLifetime, ttl, cachedContent, ret, modifiedTime;
 
 		let prefixedKey =  this->_prefix . this->getKey(keyName);
 		let this->_lastKey = prefixedKey;
 
-		if !fetch cacheDir, this->_options["cacheDir"] {
-			throw new Exception("Unexpected inconsistency in options");
-		}
-
-		let cacheFile = cacheDir . prefixedKey;
+		let cacheFile = this->getCacheFile(prefixedKey);
 
 		if file_exists(cacheFile) === true {
 
@@ -173,7 +198,8 @@ class File extends Backend
 	 */
 	public function save(var keyName = null, var content = null, lifetime = null, boolean stopBuffer = true) -> boolean
 	{
-		var lastKey, frontend, cacheDir, isBuffering, cacheFile, cachedContent, preparedContent, status;
+		var lastKey, frontend, isBuffering, cacheFile, cachedContent, preparedContent, status, lock;
+		boolean isNew;
 
 		if keyName === null {
 			let lastKey = this->_lastKey;
@@ -188,11 +214,7 @@ class File extends Backend
 
 		let frontend = this->_frontend;
 
-		if !fetch cacheDir, this->_options["cacheDir"] {
-			throw new Exception("Unexpected inconsistency in options");
-		}
-
-		let cacheFile = cacheDir . lastKey;
+		let cacheFile = this->getCacheFile(lastKey);
 
 		if content === null {
 			let cachedContent = frontend->getContent();
@@ -207,14 +229,27 @@ class File extends Backend
 		}
 
 		/**
-		 * We use file_put_contents to respect open-base-dir directive
+		 * The lock keeps increment() and decrement() from overwriting the new content
 		 */
-		let status = file_put_contents(cacheFile, preparedContent);
+		let lock = this->lockDirectory(cacheFile);
+
+		let isNew = this->_shardLevels > 0 && !file_exists(cacheFile);
+
+		let status = this->writeFile(cacheFile, preparedContent);
+
+		this->unlockDirectory(lock);
 
 		if status === false {
 			throw new Exception("Cache file ". cacheFile . " could not be written");
 		}
 
+		/**
+		 * Record the new keys in the index
+		 */
+		if isNew {
+			file_put_contents(this->getIndexFile(), lastKey . PHP_EOL, FILE_APPEND | LOCK_EX);
+		}
+
 		let isBuffering = frontend->isBuffering();
 
 		if stopBuffer === true {
@@ -237,14 +272,16 @@ class File extends Backend
 	 */
 	public function delete(var keyName) -> boolean
 	{
-		var cacheFile, cacheDir;
+		var prefixedKey, cacheFile;
 
-		if !fetch cacheDir, this->_options["cacheDir"] {
-			throw new Exception("Unexpected inconsistency in options");
-		}
+		let prefixedKey = this->_prefix . this->getKey(keyName),
+			cacheFile = this->getCacheFile(prefixedKey);
 
-		let cacheFile = cacheDir . this->_prefix . this->getKey(keyName);
 		if file_exists(cacheFile) {
+			/**
+			 * Sharded caches leave the key in the index, queryKeys() skips it
+			 * and the index is compacted once most of its keys are stale
+			 */
 			return unlink(cacheFile);
 		}
 
@@ -263,8 +300,9 @@ class File extends Backend
 	 */
 	public function queryKeys(string prefix = null) -> array
 	{
-		var item, key, cacheDir, prefixedKey;
+		var item, key, cacheDir, prefixedKey, index;
 		array keys = [];
+		int stale = 0;
 
 		if !fetch cacheDir, this->_options["cacheDir"] {
 			throw new Exception("Unexpected inconsistency in options");
@@ -274,12 +312,43 @@ class File extends Backend
 			let prefixedKey = this->_prefix . this->getKey(prefix);
 		}
 
+		/**
+		 * Sharded caches read the keys from the index
+		 */
+		if this->_shardLevels > 0 {
+			let index = this->readIndex();
+
+			for key in index {
+				if !empty prefix && !starts_with(key, prefixedKey) {
+					continue;
+				}
+
+				if file_exists(this->getCacheFile(key)) {
+					let keys[] = key;
+				} else {
+					let stale++;
+				}
+			}
+
+			/**
+			 * Remove the deleted keys once they are most of the index
+			 */
+			if stale > 64 && stale * 2 > count(index) {
+				this->pruneIndex();
+			}
+
+			return keys;
+		}
+
 		/**
 		 * We use a directory iterator to traverse the cache dir directory
 		 */
 		for item in iterator(new \DirectoryIterator(cacheDir)) {
 			if likely item->isDir() === false {
 				let key = item->getFileName();
+				if starts_with(key, ".phc") {
+					continue;
+				}
 				if !empty prefix {
 					if starts_with(key, prefixedKey) {
 						let keys[] = key;
@@ -312,7 +381,7 @@ class File extends Backend
 
 		if lastKey {
 
-			let cacheFile = this->_options["cacheDir"] . lastKey;
+			let cacheFile = this->getCacheFile(lastKey);
 
 			if file_exists(cacheFile) {
 
@@ -344,167 +413,345 @@ class File extends Backend
 	 */
 	public function increment(var keyName = null, int value = 1) -> int | null
 	{
-		var prefixedKey, cacheFile, frontend, lifetime, ttl,
-			cachedContent, result, modifiedTime;
+		return this->updateCounter(keyName, value);
+	}
 
-		let prefixedKey = this->_prefix . this->getKey(keyName),
-			this->_lastKey = prefixedKey,
-			cacheFile = this->_options["cacheDir"] . prefixedKey;
+	/**
+	 * Decrement of a given key, by number $value
+	 *
+	 * @param string|int keyName
+	 */
+	public function decrement(var keyName = null, int value = 1) -> int | null
+	{
+		return this->updateCounter(keyName, -value);
+	}
 
-		if file_exists(cacheFile) {
+	/**
+	 * Immediately invalidates all existing items.
+	 */
+	public function flush() -> boolean
+	{
+		var prefix, cacheDir, item, key, cacheFile, indexFile, items;
 
-			let frontend = this->_frontend;
+		let prefix = this->_prefix;
 
-			/**
-			 * Take the lifetime from the frontend or read it from the set in start()
-			 */
-			let lifetime = this->_lastLifetime;
-			if !lifetime {
-				let ttl = frontend->getLifeTime();
-			} else {
-				let ttl = lifetime;
-			}
+		if !fetch cacheDir, this->_options["cacheDir"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
 
-			clearstatcache(true, cacheFile);
-			let modifiedTime = (int) filemtime(cacheFile);
+		if this->_shardLevels > 0 {
+			let indexFile = this->getIndexFile(),
+				items = new \RecursiveIteratorIterator(
+					new \RecursiveDirectoryIterator(cacheDir, \FilesystemIterator::SKIP_DOTS)
+				);
+		} else {
+			let indexFile = null,
+				items = new \DirectoryIterator(cacheDir);
+		}
 
-			/**
-			 * Check if the file has expired
-			 * The content is only retrieved if the content has not expired
-			 */
-			if modifiedTime + ttl > time() {
+		for item in iterator(items) {
+
+			if likely item->isFile() == true {
+				let key = item->getFileName(),
+					cacheFile = item->getPathName();
 
 				/**
-				 * Use file-get-contents to control that the openbase_dir can't be skipped
+				 * Skip the index and the files being written
 				 */
-				let cachedContent = file_get_contents(cacheFile);
-
-				if cachedContent === false {
-					throw new Exception("Cache file " . cacheFile . " could not be opened");
+				if starts_with(key, ".phc") {
+					continue;
 				}
 
-				if is_numeric(cachedContent) {
-
-					let result = cachedContent + value;
-					if file_put_contents(cacheFile, result) === false {
-						throw new Exception("Cache directory could not be written");
+				if empty prefix || starts_with(key, prefix) {
+					if  !unlink(cacheFile) {
+						return false;
 					}
-
-					return result;
 				}
 			}
 		}
 
-		return null;
+		/**
+		 * Only the keys with other prefixes remain in the index
+		 */
+		if indexFile !== null && file_exists(indexFile) {
+			if empty prefix {
+				return unlink(indexFile);
+			}
+
+			this->pruneIndex();
+		}
+
+		return true;
 	}
 
 	/**
-	 * Decrement of a given key, by number $value
-	 *
-	 * @param string|int keyName
+	 * Return a file-system safe identifier for a given key
 	 */
-	public function decrement(var keyName = null, int value = 1) -> int | null
+	public function getKey(key) -> string
 	{
-		var prefixedKey, cacheFile, lifetime, ttl, cachedContent, result, modifiedTime;
+		if this->_useSafeKey === true {
+			return md5(key);
+		}
 
-		let prefixedKey = this->_prefix . this->getKey(keyName),
-			this->_lastKey = prefixedKey,
-			cacheFile = this->_options["cacheDir"] . prefixedKey;
+		return key;
+	}
 
-		if file_exists(cacheFile) {
+	/**
+	 * Set whether to use the safekey or not
+	 */
+	public function useSafeKey(bool useSafeKey) -> <File>
+	{
+		let this->_useSafeKey = useSafeKey;
 
-			/**
-			 * Take the lifetime from the frontend or read it from the set in start()
-			 */
-			let lifetime = this->_lastLifetime;
-			if !lifetime {
-				let ttl = this->_frontend->getLifeTime();
-			} else {
-				let ttl = lifetime;
+		return this;
+	}
+
+	/**
+	 * Returns the path of the file storing a prefixed key
+	 */
+	protected function getCacheFile(string! prefixedKey) -> string
+	{
+		var cacheDir, hash;
+		int level;
+
+		if !fetch cacheDir, this->_options["cacheDir"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if this->_shardLevels > 0 {
+			let hash = md5(prefixedKey);
+			for level in range(0, this->_shardLevels - 1) {
+				let cacheDir .= substr(hash, level * 2, 2) . "/";
 			}
+		}
 
-			clearstatcache(true, cacheFile);
-			let modifiedTime = (int) filemtime(cacheFile);
+		return cacheDir . prefixedKey;
+	}
 
-			/**
-			 * Check if the file has expired
-			 * The content is only retrieved if the content has not expired
-			 */
-			if modifiedTime + ttl > time() {
+	/**
+	 * Returns the path of the file recording the keys of a sharded cache
+	 */
+	protected function getIndexFile() -> string
+	{
+		return this->_options["cacheDir"] . ".phcindex";
+	}
 
-				/**
-				 * Use file-get-contents to control that the openbase_dir can't be skipped
-				 */
-				let cachedContent = file_get_contents(cacheFile);
+	/**
+	 * Returns the keys recorded in the index, they may include deleted keys
+	 */
+	protected function readIndex() -> array
+	{
+		var indexFile, handle, content, lines, keys;
 
-				if cachedContent === false {
-					throw new Exception("Cache file " . cacheFile . " could not be opened");
-				}
+		let indexFile = this->getIndexFile();
 
-				if is_numeric(cachedContent) {
+		if !file_exists(indexFile) {
+			return [];
+		}
 
-					let result = cachedContent - value;
-					if file_put_contents(cacheFile, result) === false {
-						throw new Exception("Cache directory can't be written");
-					}
+		/**
+		 * A shared lock waits for the index being compacted
+		 */
+		let handle = fopen(indexFile, "r");
+		if !handle {
+			return [];
+		}
 
-					return result;
-				}
-			}
+		flock(handle, LOCK_SH);
+		let content = stream_get_contents(handle);
+		flock(handle, LOCK_UN);
+		fclose(handle);
+
+		let lines = array_filter(explode(PHP_EOL, (string) content), "strlen"),
+			keys = array_keys(array_flip(lines));
+
+		/**
+		 * Compact the index when most of its lines are repeated keys
+		 */
+		if count(lines) > 2 * count(keys) + 64 {
+			return this->pruneIndex();
 		}
 
-		return null;
+		return keys;
 	}
 
 	/**
-	 * Immediately invalidates all existing items.
+	 * Rewrites the index without repeated keys and without the keys whose
+	 * files were deleted. The file is rewritten in place holding an exclusive
+	 * lock so the keys appended by save() at the same time are not lost
 	 */
-	public function flush() -> boolean
+	protected function pruneIndex() -> array
 	{
-		var prefix, cacheDir, item, key, cacheFile;
+		var indexFile, handle, content, lines, line, keys;
 
-		let prefix = this->_prefix;
+		let indexFile = this->getIndexFile();
 
-		if !fetch cacheDir, this->_options["cacheDir"] {
-			throw new Exception("Unexpected inconsistency in options");
+		if !file_exists(indexFile) {
+			return [];
 		}
 
-		for item in iterator(new \DirectoryIterator(cacheDir)) {
+		let handle = fopen(indexFile, "c+");
+		if !handle {
+			return [];
+		}
 
-			if likely item->isFile() == true {
-				let key = item->getFileName(),
-					cacheFile = item->getPathName();
+		if !flock(handle, LOCK_EX) {
+			fclose(handle);
+			return [];
+		}
 
-				if empty prefix || starts_with(key, prefix) {
-					if  !unlink(cacheFile) {
-						return false;
-					}
-				}
+		let content = stream_get_contents(handle),
+			lines = explode(PHP_EOL, (string) content),
+			keys = [];
+
+		for line in lines {
+			if line !== "" && !isset keys[line] && file_exists(this->getCacheFile(line)) {
+				let keys[line] = true;
 			}
 		}
 
-		return true;
+		let keys = array_keys(keys);
+
+		if count(keys) != count(lines) - 1 {
+			ftruncate(handle, 0);
+			rewind(handle);
+			if count(keys) {
+				fwrite(handle, implode(PHP_EOL, keys) . PHP_EOL);
+			}
+			fflush(handle);
+		}
+
+		flock(handle, LOCK_UN);
+		fclose(handle);
+
+		return keys;
 	}
 
 	/**
-	 * Return a file-system safe identifier for a given key
+	 * Writes a file atomically, the content is written to a temporary file
+	 * in the same directory that replaces the file once it is complete
 	 */
-	public function getKey(key) -> string
+	protected function writeFile(string! cacheFile, var content) -> int | boolean
 	{
-		if this->_useSafeKey === true {
-			return md5(key);
+		var directory, tmpFile, status;
+
+		let directory = dirname(cacheFile);
+
+		if !is_dir(directory) && !mkdir(directory, 0777, true) && !is_dir(directory) {
+			return false;
 		}
 
-		return key;
+		let tmpFile = directory . "/.phct" . uniqid("", true);
+
+		/**
+		 * We use file_put_contents to respect open-base-dir directive
+		 */
+		let status = file_put_contents(tmpFile, content);
+
+		if status === false {
+			return false;
+		}
+
+		if !rename(tmpFile, cacheFile) {
+			unlink(tmpFile);
+			return false;
+		}
+
+		return status;
 	}
 
 	/**
-	 * Set whether to use the safekey or not
+	 * Adds a value to a numeric key. The lock of the directory serializes the
+	 * updates and the new value replaces the file atomically, so get() never
+	 * reads a file being written
 	 */
-	public function useSafeKey(bool useSafeKey) -> <File>
+	protected function updateCounter(var keyName, int value) -> int | null
 	{
-		let this->_useSafeKey = useSafeKey;
+		var prefixedKey, cacheFile, lifetime, ttl, cachedContent, result,
+			lock;
 
-		return this;
+		let prefixedKey = this->_prefix . this->getKey(keyName),
+			this->_lastKey = prefixedKey,
+			cacheFile = this->getCacheFile(prefixedKey);
+
+		if !file_exists(cacheFile) {
+			return null;
+		}
+
+		/**
+		 * Take the lifetime from the frontend or read it from the set in start()
+		 */
+		let lifetime = this->_lastLifetime;
+		if !lifetime {
+			let ttl = this->_frontend->getLifeTime();
+		} else {
+			let ttl = lifetime;
+		}
+
+		let lock = this->lockDirectory(cacheFile);
+
+		/**
+		 * Check if the file has expired or was deleted before the lock was taken
+		 * The content is only retrieved if the content has not expired
+		 */
+		clearstatcache(true, cacheFile);
+		if !file_exists(cacheFile) || (int) filemtime(cacheFile) + ttl <= time() {
+			this->unlockDirectory(lock);
+			return null;
+		}
+
+		let cachedContent = file_get_contents(cacheFile),
+			result = null;
+
+		if is_numeric(cachedContent) {
+
+			let result = cachedContent + value;
+
+			if this->writeFile(cacheFile, result) === false {
+				this->unlockDirectory(lock);
+				throw new Exception("Cache directory could not be written");
+			}
+		}
+
+		this->unlockDirectory(lock);
+
+		return result;
+	}
+
+	/**
+	 * Takes the exclusive lock of the directory of a cache file, the lock is
+	 * held on a separate file because the cache files are replaced on every write
+	 */
+	protected function lockDirectory(string! cacheFile)
+	{
+		var directory, handle;
+
+		let directory = dirname(cacheFile);
+
+		if !is_dir(directory) && !mkdir(directory, 0777, true) && !is_dir(directory) {
+			throw new Exception("Cache directory " . directory . " could not be created");
+		}
+
+		let handle = fopen(directory . "/.phclock", "c");
+
+		if handle === false {
+			throw new Exception("Cache lock file in " . directory . " could not be opened");
+		}
+
+		if !flock(handle, LOCK_EX) {
+			fclose(handle);
+			throw new Exception("Cache lock file in " . directory . " could not be locked");
+		}
+
+		return handle;
+	}
+
+	/**
+	 * Releases a lock taken with lockDirectory()
+	 */
+	protected function unlockDirectory(var handle) -> void
+	{
+		flock(handle, LOCK_UN);
+		fclose(handle);
 	}
 }
@@ -314,6 +314,195 @@ class Libmemcached extends Backend
 		return ret;
 	}
 
+	/**
+	 * Returns the cached contents of several keys using a single getMulti
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var memcache, frontend, prefix, keyName, prefixedKeys, cachedContents,
+			cachedContent, values;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			prefixedKeys = [],
+			values = [];
+
+		if !count(keyNames) {
+			return values;
+		}
+
+		for keyName in keyNames {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let cachedContents = memcache->getMulti(prefixedKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		for keyName in keyNames {
+			if !fetch cachedContent, cachedContents[prefix . keyName] || !cachedContent {
+				let values[keyName] = null;
+			} elseif is_numeric(cachedContent) {
+				let values[keyName] = cachedContent;
+			} else {
+				let values[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return values;
+	}
+
+	/**
+	 * Stores several contents using a single setMulti
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function saveMultiple(array! values, lifetime = null) -> boolean
+	{
+		var memcache, frontend, prefix, specialKey, ttl, keyName, content,
+			prefixedKey, items, keys;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		if !fetch specialKey, this->_options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			items = [];
+
+		if lifetime === null {
+			let ttl = this->_lastLifetime;
+			if !ttl {
+				let ttl = frontend->getLifetime();
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		for keyName, content in values {
+			if !is_numeric(content) {
+				let content = frontend->beforeStore(content);
+			}
+
+			let items[prefix . keyName] = content;
+		}
+
+		if !count(items) {
+			return true;
+		}
+
+		if !memcache->setMulti(items, ttl) {
+			throw new Exception("Failed storing data in memcached, error code: " . memcache->getResultCode());
+		}
+
+		if specialKey != "" {
+			/**
+			 * Update the stats key
+			 */
+			let keys = memcache->get(specialKey);
+			if typeof keys != "array" {
+				let keys = [];
+			}
+
+			for prefixedKey, content in items {
+				let keys[prefixedKey] = ttl;
+			}
+
+			memcache->set(specialKey, keys);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys using a single deleteMulti
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function deleteMultiple(array! keyNames) -> boolean
+	{
+		var memcache, prefix, specialKey, keyName, prefixedKey, prefixedKeys,
+			keys, results, result;
+
+		if !count(keyNames) {
+			return true;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		if !fetch specialKey, this->_options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keyNames {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		if specialKey != "" {
+			let keys = memcache->get(specialKey);
+			if typeof keys == "array" {
+				for prefixedKey in prefixedKeys {
+					unset keys[prefixedKey];
+				}
+				memcache->set(specialKey, keys);
+			}
+		}
+
+		/**
+		 * Every key is returned with true or the code of the error
+		 */
+		let results = memcache->deleteMulti(prefixedKeys);
+		if typeof results != "array" {
+			return false;
+		}
+
+		for result in results {
+			if result !== true {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Takes the lock used to recompute an expired key with an atomic add
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		var memcache;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		return (bool) memcache->add(this->_prefix . lockKey, "lock", lifetime);
+	}
+
 	/**
 	 * Query the existing cached keys.
 	 *
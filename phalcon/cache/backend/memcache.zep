@@ -170,6 +170,55 @@ class Memcache extends Backend
 		return retrieve;
 	}
 
+	/**
+	 * Returns the cached contents of several keys in a single request, the
+	 * memcache extension does not batch writes and deletes so saveMultiple
+	 * and deleteMultiple send one request per key
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var memcache, frontend, prefix, keyName, prefixedKeys, cachedContents,
+			cachedContent, values;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			prefixedKeys = [],
+			values = [];
+
+		if !count(keyNames) {
+			return values;
+		}
+
+		for keyName in keyNames {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let cachedContents = memcache->get(prefixedKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		for keyName in keyNames {
+			if !fetch cachedContent, cachedContents[prefix . keyName] || cachedContent === false {
+				let values[keyName] = null;
+			} elseif is_numeric(cachedContent) {
+				let values[keyName] = cachedContent;
+			} else {
+				let values[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return values;
+	}
+
 	/**
 	 * Stores cached content into the file backend and stops the frontend
 	 *
@@ -316,6 +365,22 @@ class Memcache extends Backend
 		return ret;
 	}
 
+	/**
+	 * Takes the lock used to recompute an expired key with an atomic add
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		var memcache;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		return (bool) memcache->add(this->_prefix . lockKey, "lock", 0, lifetime);
+	}
+
 	/**
 	 * Query the existing cached keys.
 	 *
@@ -318,6 +318,175 @@ class Redis extends Backend
 		return (bool) redis->delete(lastKey);
 	}
 
+	/**
+	 * Returns the cached contents of several keys using a single MGET
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var redis, frontend, prefix, keyName, lastKeys, cachedContents,
+			cachedContent, values;
+		int position;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			lastKeys = [],
+			values = [];
+
+		if !count(keyNames) {
+			return values;
+		}
+
+		for keyName in keyNames {
+			let lastKeys[] = "_PHCR" . prefix . keyName;
+		}
+
+		let cachedContents = redis->mGet(lastKeys),
+			position = 0;
+
+		for keyName in keyNames {
+			if !fetch cachedContent, cachedContents[position] || cachedContent === false {
+				let values[keyName] = null;
+			} elseif is_numeric(cachedContent) {
+				let values[keyName] = cachedContent;
+			} else {
+				let values[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+
+			let position++;
+		}
+
+		return values;
+	}
+
+	/**
+	 * Stores several contents sending all the commands in a single pipeline
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function saveMultiple(array! values, lifetime = null) -> boolean
+	{
+		var redis, frontend, prefix, specialKey, ttl, keyName, content,
+			prefixedKey, lastKey, results, result;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		if !fetch specialKey, this->_options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix;
+
+		if lifetime === null {
+			let ttl = this->_lastLifetime;
+			if !ttl {
+				let ttl = frontend->getLifetime();
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		redis->multi(constant("Redis::PIPELINE"));
+
+		for keyName, content in values {
+			let prefixedKey = prefix . keyName,
+				lastKey = "_PHCR" . prefixedKey;
+
+			if !is_numeric(content) {
+				let content = frontend->beforeStore(content);
+			}
+
+			// Don't set expiration for negative ttl or zero
+			if ttl >= 1 {
+				redis->setex(lastKey, ttl, content);
+			} else {
+				redis->set(lastKey, content);
+			}
+
+			if specialKey != "" {
+				redis->sAdd(specialKey, prefixedKey);
+			}
+		}
+
+		let results = redis->exec();
+
+		if typeof results == "array" {
+			for result in results {
+				if result === false {
+					throw new Exception("Failed storing the data in redis");
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys with a single DEL command
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function deleteMultiple(array! keyNames) -> boolean
+	{
+		var redis, prefix, specialKey, keyName, prefixedKey, lastKeys;
+
+		if !count(keyNames) {
+			return true;
+		}
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		if !fetch specialKey, this->_options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let prefix = this->_prefix,
+			lastKeys = [];
+
+		for keyName in keyNames {
+			let prefixedKey = prefix . keyName,
+				lastKeys[] = "_PHCR" . prefixedKey;
+
+			if specialKey != "" {
+				redis->sRem(specialKey, prefixedKey);
+			}
+		}
+
+		return redis->delete(lastKeys) == count(lastKeys);
+	}
+
+	/**
+	 * Takes the lock used to recompute an expired key with SET NX
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		var redis;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		return (bool) redis->set("_PHCR" . this->_prefix . lockKey, "lock", ["nx", "ex": lifetime]);
+	}
+
 	/**
 	 * Query the existing cached keys.
 	 *
@@ -133,6 +133,70 @@ class Multiple
 		return null;
 	}
 
+	/**
+	 * Returns the cached contents of several keys reading the internal
+	 * backends, every backend is only asked for the keys missing in the
+	 * faster ones and the values found are written back to the faster
+	 * backends in a single batch
+	 *
+	 *<code>
+	 * $values = $cache->getMultiple(["my-key", "other-key"]);
+	 *</code>
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var backend, fasterBackend, values, missing, remaining, found,
+			keyName, content, faster;
+
+		let values = [],
+			missing = [],
+			faster = [];
+
+		for keyName in keyNames {
+			let values[keyName] = null,
+				missing[] = keyName;
+		}
+
+		for backend in this->_backends {
+
+			if !count(missing) {
+				break;
+			}
+
+			let found = [];
+
+			for keyName, content in this->_getMultiple(backend, missing, lifetime) {
+				if content != null {
+					let found[keyName] = content,
+						values[keyName] = content;
+				}
+			}
+
+			if count(found) {
+
+				/**
+				 * Back-fill the faster backends
+				 */
+				for fasterBackend in faster {
+					this->_saveMultiple(fasterBackend, found);
+				}
+
+				let remaining = [];
+				for keyName in missing {
+					if !isset found[keyName] {
+						let remaining[] = keyName;
+					}
+				}
+
+				let missing = remaining;
+			}
+
+			let faster[] = backend;
+		}
+
+		return values;
+	}
+
 	/**
 	 * Starts every backend
 	 *
@@ -214,4 +278,85 @@ class Multiple
 
 		return true;
 	}
+
+	/**
+	 * Stores several contents into all backends
+	 *
+	 *<code>
+	 * $cache->saveMultiple(
+	 *     [
+	 *         "my-key"    => $data,
+	 *         "other-key" => $otherData,
+	 *     ]
+	 * );
+	 *</code>
+	 */
+	public function saveMultiple(array! values, lifetime = null) -> boolean
+	{
+		var backend;
+
+		for backend in this->_backends {
+			this->_saveMultiple(backend, values, lifetime);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several values from each backend
+	 */
+	public function deleteMultiple(array! keyNames) -> boolean
+	{
+		var backend, keyName;
+
+		for backend in this->_backends {
+			if method_exists(backend, "deleteMultiple") {
+				backend->{"deleteMultiple"}(keyNames);
+			} else {
+				for keyName in keyNames {
+					backend->delete(keyName);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Reads several keys from a backend, one by one if it cannot read them
+	 * in a batch
+	 */
+	protected function _getMultiple(<BackendInterface> backend, array! keyNames, lifetime = null) -> array
+	{
+		var keyName, values;
+
+		if method_exists(backend, "getMultiple") {
+			return backend->{"getMultiple"}(keyNames, lifetime);
+		}
+
+		let values = [];
+		for keyName in keyNames {
+			let values[keyName] = backend->get(keyName, lifetime);
+		}
+
+		return values;
+	}
+
+	/**
+	 * Stores several contents into a backend, one by one if it cannot store
+	 * them in a batch
+	 */
+	protected function _saveMultiple(<BackendInterface> backend, array! values, lifetime = null) -> void
+	{
+		var keyName, content;
+
+		if method_exists(backend, "saveMultiple") {
+			backend->{"saveMultiple"}(values, lifetime);
+			return;
+		}
+
+		for keyName, content in values {
+			backend->save(keyName, content, lifetime, false);
+		}
+	}
 }
@@ -76,6 +76,32 @@ class Crypt implements CryptInterface
 	 */
 	protected useSigning = false;
 
+	/**
+	 * The cipher mode, resolved when the cipher is set.
+	 * @var string
+	 */
+	protected mode;
+
+	/**
+	 * The cipher block size, resolved when the cipher is set.
+	 * @var int
+	 */
+	protected blockSize;
+
+	/**
+	 * Whether the cipher authenticates the data by itself (GCM, Poly1305).
+	 * @var bool
+	 */
+	protected authenticated = false;
+
+	/**
+	 * The length of the digest of the hashing algorithm.
+	 * @var int|null
+	 */
+	protected hashLength = null;
+
+	const TAG_LENGTH = 16;
+
 	const PADDING_DEFAULT = 0;
 
 	const PADDING_ANSI_X_923 = 1;
@@ -113,19 +139,56 @@ class Crypt implements CryptInterface
 	/**
 	 * Sets the cipher algorithm for data encryption and decryption.
 	 *
-	 * The `aes-256-gcm' is the preferable cipher, but it is not usable
-	 * until the openssl library is upgraded, which is available in PHP 7.1.
+	 * The `aes-*-gcm' ciphers authenticate the data by themselves, the
+	 * message digest is not computed for them. They require PHP 7.1, an
+	 * exception is thrown on older versions. The `chacha20-poly1305'
+	 * cipher is only authenticated from PHP 8.2, when OpenSSL returns its
+	 * tag, older versions use it as an unauthenticated cipher.
 	 *
 	 * The `aes-256-ctr' is arguably the best choice for cipher
-	 * algorithm for current openssl library version.
+	 * algorithm for older openssl library versions.
 	 */
 	public function setCipher(string! cipher) -> <Crypt>
 	{
+		var mode, ivLength, authenticated, authenticatedCiphers;
+
 		this->assertCipherIsAvailable(cipher);
 
-		let this->ivLength = this->getIvLength(cipher),
+		/**
+		 * openssl_encrypt/openssl_decrypt don't accept the tag before PHP 7.1
+		 * and don't return it for chacha20-poly1305 before PHP 8.2
+		 */
+		let authenticatedCiphers = ["aes-128-gcm", "aes-192-gcm", "aes-256-gcm"];
+		if PHP_VERSION_ID >= 80200 {
+			let authenticatedCiphers[] = "chacha20-poly1305";
+		}
+
+		let authenticated = in_array(strtolower(cipher), authenticatedCiphers);
+
+		if authenticated && PHP_VERSION_ID < 70100 {
+			throw new Exception(
+				sprintf("The cipher algorithm \"%s\" requires PHP 7.1 or greater", cipher)
+			);
+		}
+
+		/**
+		 * The mode and the sizes are resolved only once for every cipher
+		 */
+		let mode = strtolower(substr(cipher, strrpos(cipher, "-") - strlen(cipher))),
+			ivLength = this->getIvLength(cipher);
+
+		let this->ivLength = ivLength,
+			this->mode     = mode,
 			this->_cipher  = cipher;
 
+		if ivLength > 0 {
+			let this->blockSize = ivLength;
+		} else {
+			let this->blockSize = this->getIvLength(str_ireplace("-" . mode, "", cipher));
+		}
+
+		let this->authenticated = authenticated;
+
 		return this;
 	}
 
@@ -176,7 +239,8 @@ class Crypt implements CryptInterface
 	{
 		this->assertHashAlgorithmAvailable(hashAlgo);
 
-		let this->hashAlgo = hashAlgo;
+		let this->hashAlgo = hashAlgo,
+			this->hashLength = null;
 
 		return this;
 	}
@@ -375,7 +439,7 @@ class Crypt implements CryptInterface
 	 */
 	public function encrypt(string! text, string! key = null) -> string
 	{
-		var encryptKey, ivLength, iv, cipher, mode, blockSize, paddingType, padded, encrypted;
+		var encryptKey, ivLength, iv, cipher, mode, blockSize, paddingType, padded, encrypted, tag;
 
 		if likely empty key {
 			let encryptKey = this->_key;
@@ -387,19 +451,31 @@ class Crypt implements CryptInterface
 			throw new Exception("Encryption key cannot be empty");
 		}
 
-		let cipher = this->_cipher;
-		let mode = strtolower(substr(cipher, strrpos(cipher, "-") - strlen(cipher)));
+		let cipher = this->_cipher,
+			mode = this->mode,
+			ivLength = this->ivLength,
+			blockSize = this->blockSize;
 
-		this->assertCipherIsAvailable(cipher);
+		let iv = openssl_random_pseudo_bytes(ivLength);
 
-		let ivLength = this->ivLength;
-		if likely ivLength > 0 {
-			let blockSize = ivLength;
-		} else {
-			let blockSize = this->getIvLength(str_ireplace("-" . mode, "", cipher));
+		/**
+		 * AEAD ciphers authenticate the data with the tag
+		 */
+		if this->authenticated {
+			let tag = "",
+				encrypted = openssl_encrypt(text, cipher, encryptKey, OPENSSL_RAW_DATA, iv, tag, "", self::TAG_LENGTH);
+
+			if encrypted === false {
+				throw new Exception("Unable to encrypt the text with the cipher algorithm \"" . cipher . "\"");
+			}
+
+			if mb_strlen(tag, "8bit") != self::TAG_LENGTH {
+				throw new Exception("The authentication tag has an invalid length");
+			}
+
+			return iv . tag . encrypted;
 		}
 
-		let iv = openssl_random_pseudo_bytes(ivLength);
 		let paddingType = this->_padding;
 
 		if paddingType != 0 && (mode == "cbc" || mode == "ecb") {
@@ -437,7 +513,7 @@ class Crypt implements CryptInterface
 	public function decrypt(string! text, string! key = null) -> string
 	{
 		var decryptKey, ivLength, cipher, mode, blockSize, decrypted,
-			ciphertext, hashAlgo, hashLength, iv, hash;
+			ciphertext, hashAlgo, hashLength, iv, hash, tag;
 
 		if likely empty key {
 			let decryptKey = this->_key;
@@ -449,23 +525,33 @@ class Crypt implements CryptInterface
 			throw new Exception("Decryption key cannot be empty");
 		}
 
-		let cipher = this->_cipher;
-		let mode = strtolower(substr(cipher, strrpos(cipher, "-") - strlen(cipher)));
+		let cipher = this->_cipher,
+			mode = this->mode,
+			ivLength = this->ivLength,
+			blockSize = this->blockSize;
 
-		this->assertCipherIsAvailable(cipher);
+		let iv = mb_substr(text, 0, ivLength, "8bit");
 
-		let ivLength = this->ivLength;
-		if likely ivLength > 0 {
-			let blockSize = ivLength;
-		} else {
-			let blockSize = this->getIvLength(str_ireplace("-" . mode, "", cipher));
-		}
+		if this->authenticated {
+			let tag = mb_substr(text, ivLength, self::TAG_LENGTH, "8bit"),
+				ciphertext = mb_substr(text, ivLength + self::TAG_LENGTH, null, "8bit"),
+				decrypted = openssl_decrypt(ciphertext, cipher, decryptKey, OPENSSL_RAW_DATA, iv, tag);
 
-		let iv = mb_substr(text, 0, ivLength, "8bit");
+			if decrypted === false {
+				throw new Mismatch("Hash does not match.");
+			}
+
+			return decrypted;
+		}
 
 		if this->useSigning {
 			let hashAlgo = this->getHashAlgo();
-			let hashLength = strlen(hash(hashAlgo, "", true));
+
+			let hashLength = this->hashLength;
+			if hashLength === null {
+				let hashLength = strlen(hash(hashAlgo, "", true)),
+					this->hashLength = hashLength;
+			}
 			let hash = mb_substr(text, ivLength, hashLength, "8bit");
 			let ciphertext = mb_substr(text, ivLength + hashLength, null, "8bit");
 			let decrypted = openssl_decrypt(ciphertext, cipher, decryptKey, OPENSSL_RAW_DATA, iv);
@@ -494,6 +580,49 @@ class Crypt implements CryptInterface
 		return decrypted;
 	}
 
+	/**
+	 * Encrypts many texts with the same key, keeping their keys.
+	 *
+	 * <code>
+	 * $encrypted = $crypt->encryptMany(
+	 *     [
+	 *         "name"  => "Top secret",
+	 *         "email" => "secret@phalconphp.com",
+	 *     ]
+	 * );
+	 * </code>
+	 */
+	public function encryptMany(array! texts, string! key = null) -> array
+	{
+		var index, text, encrypted;
+
+		let encrypted = [];
+
+		for index, text in texts {
+			let encrypted[index] = this->encrypt(text, key);
+		}
+
+		return encrypted;
+	}
+
+	/**
+	 * Decrypts many encrypted texts with the same key, keeping their keys.
+	 *
+	 * @throws \Phalcon\Crypt\Mismatch
+	 */
+	public function decryptMany(array! texts, string! key = null) -> array
+	{
+		var index, text, decrypted;
+
+		let decrypted = [];
+
+		for index, text in texts {
+			let decrypted[index] = this->decrypt(text, key);
+		}
+
+		return decrypted;
+	}
+
 	/**
 	 * Encrypts a text returning the result as a base64 string.
 	 */
@@ -308,9 +308,7 @@ abstract class Adapter implements AdapterInterface, EventsAwareInterface
 	 */
 	public function insert(var table, array! values, var fields = null, var dataTypes = null) -> boolean
 	{
-		var placeholders, insertValues, bindDataTypes, bindType,
-			position, value, escapedTable, joinedValues, escapedFields,
-			field, insertSql;
+		var statement;
 
 		/**
 		 * A valid array with more than one element is required
@@ -319,31 +317,283 @@ abstract class Adapter implements AdapterInterface, EventsAwareInterface
 			throw new Exception("Unable to insert into " . table . " without data");
 		}
 
-		let placeholders = [],
-			insertValues = [];
-
-		let bindDataTypes = [];
+		let statement = this->_prepareInsert(table, [values], fields, dataTypes);
 
 		/**
-		 * Objects are casted using __toString, null values are converted to string "null", everything else is passed as "?"
+		 * Perform the execution via PDO::execute
 		 */
-		for position, value in values {
-			if typeof value == "object" {
-				let placeholders[] = (string) value;
+		if !count(statement[2]) {
+			return this->{"execute"}(statement[0], statement[1]);
+		}
+
+		return this->{"execute"}(statement[0], statement[1], statement[2]);
+	}
+
+	/**
+	 * Inserts many rows into a table using multi-row INSERT statements, the
+	 * rows are sent in chunks to keep the statements under the limits of
+	 * the database system
+	 *
+	 * <code>
+	 * // Inserting two robots
+	 * $success = $connection->insertMultiple(
+	 *     "robots",
+	 *     [
+	 *         ["Astro Boy", 1952],
+	 *         ["Robotina", 1972],
+	 *     ],
+	 *     ["name", "year"]
+	 * );
+	 *
+	 * // Next SQL sentence is sent to the database system
+	 * INSERT INTO `robots` (`name`, `year`) VALUES ("Astro boy", 1952), ("Robotina", 1972);
+	 * </code>
+	 *
+	 * @param   string|array table
+	 * @param 	array rows
+	 * @param 	array fields
+	 * @param 	array dataTypes
+	 * @param 	int chunkSize
+	 * @return 	boolean
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function insertMultiple(var table, array! rows, var fields = null, var dataTypes = null, int chunkSize = 500) -> boolean
+	{
+		var chunk, statement, success;
+
+		if !count(rows) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		if chunkSize < 1 {
+			throw new Exception("The size of the chunks must be greater than zero");
+		}
+
+		for chunk in array_chunk(rows, chunkSize) {
+
+			let statement = this->_prepareInsert(table, chunk, fields, dataTypes);
+
+			if !count(statement[2]) {
+				let success = this->{"execute"}(statement[0], statement[1]);
 			} else {
-				if typeof value == "null" {
-					let placeholders[] = "null";
+				let success = this->{"execute"}(statement[0], statement[1], statement[2]);
+			}
+
+			if !success {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Inserts a row into a table or updates the given fields if it conflicts
+	 * with an existing row, using the syntax of the dialect
+	 *
+	 * <code>
+	 * // Inserting or renaming the robot 1
+	 * $success = $connection->upsert(
+	 *     "robots",
+	 *     [1, "Astro Boy", 1952],
+	 *     ["id", "name", "year"],
+	 *     ["name"],
+	 *     ["id"]
+	 * );
+	 *
+	 * // Next SQL sentence is sent to MySQL
+	 * INSERT INTO `robots` (`id`, `name`, `year`) VALUES (1, "Astro boy", 1952) ON DUPLICATE KEY UPDATE `name` = VALUES(`name`);
+	 * </code>
+	 *
+	 * @param   string|array table
+	 * @param 	array values
+	 * @param 	array fields
+	 * @param 	array updateFields
+	 * @param 	array conflictFields
+	 * @param 	array dataTypes
+	 * @return 	boolean
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function upsert(var table, array! values, array! fields, array! updateFields, array! conflictFields = [], var dataTypes = null) -> boolean
+	{
+		if !count(values) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		return this->upsertMultiple(table, [values], fields, updateFields, conflictFields, dataTypes);
+	}
+
+	/**
+	 * Inserts many rows into a table or updates the given fields of the
+	 * rows conflicting with existing ones, the rows are sent in chunks of
+	 * multi-row statements
+	 *
+	 * <code>
+	 * // Inserting or renaming the robots 1 and 2
+	 * $success = $connection->upsertMultiple(
+	 *     "robots",
+	 *     [
+	 *         [1, "Astro Boy"],
+	 *         [2, "Robotina"],
+	 *     ],
+	 *     ["id", "name"],
+	 *     ["name"],
+	 *     ["id"]
+	 * );
+	 * </code>
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function upsertMultiple(var table, array! rows, array! fields, array! updateFields, array! conflictFields = [], var dataTypes = null, int chunkSize = 500) -> boolean
+	{
+		var chunk, statement, upsertSql, success;
+
+		if !count(rows) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		if chunkSize < 1 {
+			throw new Exception("The size of the chunks must be greater than zero");
+		}
+
+		for chunk in array_chunk(rows, chunkSize) {
+
+			let statement = this->_prepareInsert(table, chunk, fields, dataTypes),
+				upsertSql = this->_dialect->{"upsert"}(statement[0], updateFields, conflictFields);
+
+			if !count(statement[2]) {
+				let success = this->{"execute"}(upsertSql, statement[1]);
+			} else {
+				let success = this->{"execute"}(upsertSql, statement[1], statement[2]);
+			}
+
+			if !success {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Inserts many rows like insertMultiple() and returns the identities
+	 * generated for the given identity column in the order of the rows, or
+	 * false if any chunk fails
+	 *
+	 * <code>
+	 * $ids = $connection->insertMultipleReturningIds(
+	 *     "robots",
+	 *     [
+	 *         ["Astro Boy", 1952],
+	 *         ["Robotina", 1972],
+	 *     ],
+	 *     ["name", "year"],
+	 *     null,
+	 *     "id"
+	 * );
+	 * </code>
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function insertMultipleReturningIds(var table, array! rows, var fields, var dataTypes, string! identityField, int chunkSize = 500) -> array | boolean
+	{
+		var chunk, statement, chunkIds, ids;
+
+		if !count(rows) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		if chunkSize < 1 {
+			throw new Exception("The size of the chunks must be greater than zero");
+		}
+
+		let ids = [];
+
+		for chunk in array_chunk(rows, chunkSize) {
+
+			let statement = this->_prepareInsert(table, chunk, fields, dataTypes),
+				chunkIds = this->_executeInsertReturningIds(statement, count(chunk), identityField);
+
+			if typeof chunkIds != "array" {
+				return false;
+			}
+
+			let ids = array_merge(ids, chunkIds);
+		}
+
+		return ids;
+	}
+
+	/**
+	 * Executes a multi-row INSERT statement and returns the generated
+	 * identities. The last insert id of MySQL is the one generated for the
+	 * first row, the next ones are consecutive as long as the auto-increment
+	 * lock mode (innodb_autoinc_lock_mode) is "traditional" or "consecutive"
+	 */
+	protected function _executeInsertReturningIds(array! statement, int rowCount, string! identityField) -> array | boolean
+	{
+		var success, firstId;
+
+		if !count(statement[2]) {
+			let success = this->{"execute"}(statement[0], statement[1]);
+		} else {
+			let success = this->{"execute"}(statement[0], statement[1], statement[2]);
+		}
+
+		if !success {
+			return false;
+		}
+
+		let firstId = this->{"lastInsertId"}();
+		if !firstId {
+			return false;
+		}
+
+		return range((int) firstId, (int) firstId + rowCount - 1);
+	}
+
+	/**
+	 * Builds the INSERT statement for the given rows, returns the SQL, the
+	 * values to bind and their types
+	 */
+	protected function _prepareInsert(var table, array! rows, var fields, var dataTypes) -> array
+	{
+		var placeholders, rowsPlaceholders, insertValues, bindDataTypes, bindType,
+			row, position, value, escapedTable, escapedFields, field, insertSql;
+
+		let rowsPlaceholders = [],
+			insertValues = [],
+			bindDataTypes = [];
+
+		for row in rows {
+
+			let placeholders = [];
+
+			/**
+			 * Objects are casted using __toString, null values are converted to string "null", everything else is passed as "?"
+			 */
+			for position, value in row {
+				if typeof value == "object" {
+					let placeholders[] = (string) value;
 				} else {
-					let placeholders[] = "?";
-					let insertValues[] = value;
-					if typeof dataTypes == "array" {
-						if !fetch bindType, dataTypes[position] {
-							throw new Exception("Incomplete number of bind types");
+					if typeof value == "null" {
+						let placeholders[] = "null";
+					} else {
+						let placeholders[] = "?";
+						let insertValues[] = value;
+						if typeof dataTypes == "array" {
+							if !fetch bindType, dataTypes[position] {
+								throw new Exception("Incomplete number of bind types");
+							}
+							let bindDataTypes[] = bindType;
 						}
-						let bindDataTypes[] = bindType;
 					}
 				}
 			}
+
+			let rowsPlaceholders[] = "(" . join(", ", placeholders) . ")";
 		}
 
 		let escapedTable = this->escapeIdentifier(table);
@@ -351,26 +601,18 @@ abstract class Adapter implements AdapterInterface, EventsAwareInterface
 		/**
 		 * Build the final SQL INSERT statement
 		 */
-		let joinedValues = join(", ", placeholders);
 		if typeof fields == "array" {
 			let escapedFields = [];
 			for field in fields {
 				let escapedFields[] = this->escapeIdentifier(field);
 			}
 
-			let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES (" . joinedValues . ")";
+			let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES " . join(", ", rowsPlaceholders);
 		} else {
-			let insertSql = "INSERT INTO " . escapedTable . " VALUES (" . joinedValues . ")";
+			let insertSql = "INSERT INTO " . escapedTable . " VALUES " . join(", ", rowsPlaceholders);
 		}
 
-		/**
-		 * Perform the execution via PDO::execute
-		 */
-		if !count(bindDataTypes) {
-			return this->{"execute"}(insertSql, insertValues);
-		}
-
-		return this->{"execute"}(insertSql, insertValues, bindDataTypes);
+		return [insertSql, insertValues, bindDataTypes];
 	}
 
 	/**
@@ -889,6 +1131,30 @@ abstract class Adapter implements AdapterInterface, EventsAwareInterface
 		return allTables;
 	}
 
+	/**
+	 * Returns the Phalcon\Db\Column objects of every table in a schema
+	 * indexed by table name
+	 *
+	 *<code>
+	 * print_r(
+	 *     $connection->describeSchemaColumns("blog")
+	 * );
+	 *</code>
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function describeSchemaColumns(string schema = null) -> array
+	{
+		var table, tables;
+
+		let tables = [];
+		for table in this->listTables(schema) {
+			let tables[table] = this->{"describeColumns"}(table, schema);
+		}
+
+		return tables;
+	}
+
 	/**
 	 * Lists table indexes
 	 *
@@ -60,6 +60,26 @@ abstract class Pdo extends Adapter
 	 */
 	protected _affectedRows;
 
+	/**
+	 * Prepared statements reused by query/execute, ordered from the least to
+	 * the most recently used
+	 */
+	protected _statements = [];
+
+	/**
+	 * Maximum number of prepared statements kept, 0 disables the cache
+	 */
+	protected _statementCacheSize = 0;
+
+	/**
+	 * Cached statements whose results are still being read, indexed by their object hash
+	 */
+	protected _statementsInUse = [];
+
+	protected _statementCacheHits = 0;
+
+	protected _statementCacheMisses = 0;
+
 	/**
 	 * Constructor for Phalcon\Db\Adapter\Pdo
 	 */
@@ -95,7 +115,7 @@ abstract class Pdo extends Adapter
 	public function connect(array descriptor = null) -> boolean
 	{
 		var username, password, dsnParts, dsnAttributes,
-			persistent, options, key, value;
+			persistent, options, key, value, statementCacheSize;
 
 		if empty descriptor {
 			let descriptor = (array) this->_descriptor;
@@ -155,6 +175,14 @@ abstract class Pdo extends Adapter
 			unset descriptor["dialectClass"];
 		}
 
+		/**
+		 * Check if the prepared statements must be reused
+		 */
+		if fetch statementCacheSize, descriptor["statementCacheSize"] {
+			let this->_statementCacheSize = (int) statementCacheSize;
+			unset descriptor["statementCacheSize"];
+		}
+
 		/**
 		 * Check if the user has defined a custom dsn
 		 */
@@ -173,6 +201,12 @@ abstract class Pdo extends Adapter
 		 */
 		let this->_pdo = new \Pdo(this->_type . ":" . dsnAttributes, username, password, options);
 
+		/**
+		 * Prepared statements belong to the previous connection
+		 */
+		let this->_statements = [],
+			this->_statementsInUse = [];
+
 		return true;
 	}
 
@@ -317,6 +351,64 @@ abstract class Pdo extends Adapter
 		return statement;
 	}
 
+	/**
+	 * Sends a SELECT statement to the database server returning a result that
+	 * fetches the rows from the server as they are traversed instead of buffering
+	 * them on the client. The statement is never taken from the statements cache
+	 *
+	 *<code>
+	 * $result = $connection->queryStream(
+	 *     "SELECT * FROM robots WHERE type = ?",
+	 *     [
+	 *         "mechanical",
+	 *     ]
+	 * );
+	 *
+	 * while ($robot = $result->fetch()) {
+	 *     echo $robot["name"];
+	 * }
+	 *</code>
+	 */
+	public function queryStream(string! sqlStatement, var bindParams = null, var bindTypes = null) -> <ResultInterface> | boolean
+	{
+		var eventsManager, pdo, statement;
+
+		let eventsManager = <ManagerInterface> this->_eventsManager;
+
+		/**
+		 * Execute the beforeQuery event if an EventsManager is available
+		 */
+		if typeof eventsManager == "object" {
+			let this->_sqlStatement = sqlStatement,
+				this->_sqlVariables = bindParams,
+				this->_sqlBindTypes = bindTypes;
+			if eventsManager->fire("db:beforeQuery", this) === false {
+				return false;
+			}
+		}
+
+		let pdo = <\Pdo> this->_pdo;
+		let statement = pdo->prepare(sqlStatement, this->getStreamingOptions());
+		if typeof statement == "object" {
+			if typeof bindParams != "array" {
+				let bindParams = [];
+			}
+			let statement = this->executePrepared(statement, bindParams, bindTypes);
+		}
+
+		/**
+		 * Execute the afterQuery event if an EventsManager is available
+		 */
+		if typeof statement == "object" {
+			if typeof eventsManager == "object" {
+				eventsManager->fire("db:afterQuery", this);
+			}
+			return new ResultPdo(this, statement, sqlStatement, bindParams, bindTypes);
+		}
+
+		return statement;
+	}
+
 	/**
 	 * Sends SQL statements to the database server returning the success state.
 	 * Use this method only when the SQL statement sent to the server is returning rows
@@ -337,7 +429,7 @@ abstract class Pdo extends Adapter
 	 */
 	public function query(string! sqlStatement, var bindParams = null, var bindTypes = null) -> <ResultInterface> | boolean
 	{
-		var eventsManager, pdo, statement;
+		var eventsManager, pdo, statement, hash;
 
 		let eventsManager = <ManagerInterface> this->_eventsManager;
 
@@ -355,9 +447,17 @@ abstract class Pdo extends Adapter
 
 		let pdo = <\Pdo> this->_pdo;
 		if typeof bindParams == "array" {
-			let statement = pdo->prepare(sqlStatement);
+			let statement = this->prepareCached(sqlStatement);
 			if typeof statement == "object" {
 				let statement = this->executePrepared(statement, bindParams, bindTypes);
+
+				/**
+				 * The statement can't be reused until the result releases it
+				 */
+				if this->_statementCacheSize > 0 {
+					let hash = spl_object_hash(statement),
+						this->_statementsInUse[hash] = true;
+				}
 			}
 		} else {
 			let statement = pdo->query(sqlStatement);
@@ -419,7 +519,7 @@ abstract class Pdo extends Adapter
 
 		let pdo = <\Pdo> this->_pdo;
 		if typeof bindParams == "array" {
-			let statement = pdo->prepare(sqlStatement);
+			let statement = this->prepareCached(sqlStatement);
 			if typeof statement == "object" {
 				let newStatement = this->executePrepared(statement, bindParams, bindTypes),
 					affectedRows = newStatement->rowCount();
@@ -468,9 +568,161 @@ abstract class Pdo extends Adapter
 		if typeof pdo == "object" {
 			let this->_pdo = null;
 		}
+		let this->_statements = [],
+			this->_statementsInUse = [];
 		return true;
 	}
 
+	/**
+	 * Sets the maximum number of prepared statements reused by query/execute.
+	 * A size of 0 disables the cache
+	 *
+	 *<code>
+	 * $connection->setStatementCacheSize(64);
+	 *
+	 * // The statement is prepared once and executed twice
+	 * $connection->query("SELECT * FROM robots WHERE id = ?", [1]);
+	 * $connection->query("SELECT * FROM robots WHERE id = ?", [2]);
+	 *</code>
+	 *
+	 * A statement is not reused while the result of a previous query() is
+	 * still reading rows from it, a new statement is prepared instead
+	 */
+	public function setStatementCacheSize(int size) -> <Pdo>
+	{
+		var statements;
+
+		if size < 0 {
+			throw new Exception("The statement cache size must be greater or equal than zero");
+		}
+
+		let this->_statementCacheSize = size,
+			statements = this->_statements;
+
+		if count(statements) > size {
+			let this->_statements = array_slice(statements, count(statements) - size, null, true);
+		}
+
+		return this;
+	}
+
+	/**
+	 * Returns the maximum number of prepared statements reused by query/execute
+	 */
+	public function getStatementCacheSize() -> int
+	{
+		return this->_statementCacheSize;
+	}
+
+	/**
+	 * Returns the number of cached statements and the hits/misses of the cache
+	 *
+	 *<code>
+	 * print_r(
+	 *     $connection->getStatementCacheStats()
+	 * );
+	 *</code>
+	 */
+	public function getStatementCacheStats() -> array
+	{
+		return [
+			"size":     count(this->_statements),
+			"capacity": this->_statementCacheSize,
+			"hits":     this->_statementCacheHits,
+			"misses":   this->_statementCacheMisses
+		];
+	}
+
+	/**
+	 * Removes the cached prepared statements and resets the counters
+	 */
+	public function clearStatementCache() -> void
+	{
+		let this->_statements = [],
+			this->_statementsInUse = [],
+			this->_statementCacheHits = 0,
+			this->_statementCacheMisses = 0;
+	}
+
+	/**
+	 * Returns the driver options used to prepare streaming statements
+	 */
+	protected function getStreamingOptions() -> array
+	{
+		return [];
+	}
+
+	/**
+	 * Marks a cached statement as available again once its result has been
+	 * freed or completely read
+	 */
+	public function releaseStatement(<\PDOStatement> statement) -> void
+	{
+		var hash;
+
+		let hash = spl_object_hash(statement);
+		unset this->_statementsInUse[hash];
+	}
+
+	/**
+	 * Returns a prepared statement reusing the cached one if any
+	 */
+	protected function prepareCached(string! sqlStatement) -> <\PDOStatement> | boolean
+	{
+		var statements, statement, capacity, hash;
+
+		let capacity = this->_statementCacheSize;
+		if capacity <= 0 {
+			return this->_pdo->prepare(sqlStatement);
+		}
+
+		let statements = this->_statements;
+
+		if fetch statement, statements[sqlStatement] {
+
+			/**
+			 * A result is still reading from the cached statement, executing it
+			 * again would move its cursor so a new statement is prepared
+			 */
+			let hash = spl_object_hash(statement);
+			if isset this->_statementsInUse[hash] {
+				let this->_statementCacheMisses++;
+				return this->_pdo->prepare(sqlStatement);
+			}
+
+			let this->_statementCacheHits++;
+
+			/**
+			 * Move the statement to the most recently used position
+			 */
+			unset statements[sqlStatement];
+			let statements[sqlStatement] = statement,
+				this->_statements = statements;
+
+			statement->closeCursor();
+
+			return statement;
+		}
+
+		let this->_statementCacheMisses++;
+
+		let statement = this->_pdo->prepare(sqlStatement);
+		if typeof statement == "object" {
+
+			/**
+			 * Evict the least recently used statement
+			 */
+			if count(statements) >= capacity {
+				let statements = array_slice(statements, 1, null, true);
+			}
+
+			let statements[sqlStatement] = statement,
+				this->_statements = statements;
+		}
+
+		return statement;
+	}
+
 	/**
 	 * Escapes a value to avoid SQL injections according to the active charset in the connection
 	 *
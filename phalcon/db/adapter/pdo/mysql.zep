@@ -27,6 +27,7 @@ use Phalcon\Db\IndexInterface;
 use Phalcon\Db\Adapter\Pdo as PdoAdapter;
 use Phalcon\Application\Exception;
 use Phalcon\Db\ReferenceInterface;
+use Phalcon\Db\ResultInterface;
 
 /**
  * Phalcon\Db\Adapter\Pdo\Mysql
@@ -64,6 +65,49 @@ class Mysql extends PdoAdapter
 	 * </code>
 	 */
 	public function describeColumns(string table, string schema = null) -> <Column[]>
+	{
+		return this->_createColumns(
+			this->fetchAll(this->_dialect->describeColumns(table, schema), Db::FETCH_NUM)
+		);
+	}
+
+	/**
+	 * Returns the Phalcon\Db\Column objects of every table in a schema
+	 * indexed by table name, using a single query
+	 *
+	 * <code>
+	 * print_r(
+	 *     $connection->describeSchemaColumns("blog")
+	 * );
+	 * </code>
+	 */
+	public function describeSchemaColumns(string schema = null) -> array
+	{
+		var field, fields, tableName, table, tables;
+
+		/**
+		 * The table name is the last field of every row
+		 */
+		let fields = [];
+		for field in this->fetchAll(this->_dialect->{"describeSchemaColumns"}(schema), Db::FETCH_NUM) {
+			let tableName = field[6];
+			unset field[6];
+			let fields[tableName][] = field;
+		}
+
+		let tables = [];
+		for tableName, table in fields {
+			let tables[tableName] = this->_createColumns(table);
+		}
+
+		return tables;
+	}
+
+	/**
+	 * Creates the Phalcon\Db\Column objects from the rows describing a table
+	 * Field Indexes: 0:name, 1:type, 2:not null, 3:key, 4:default, 5:extra
+	 */
+	protected function _createColumns(array! fields) -> <Column[]>
 	{
 		var columns, columnType, field, definition,
 			oldColumn, sizePattern, matches, matchOne, matchTwo, columnName;
@@ -73,13 +117,7 @@ class Mysql extends PdoAdapter
 
 		let columns = [];
 
-		/**
-		 * Get the SQL to describe a table
-		 * We're using FETCH_NUM to fetch the columns
-		 * Get the describe
-		 * Field Indexes: 0:name, 1:type, 2:not null, 3:key, 4:default, 5:extra
-		 */
-		for field in this->fetchAll(this->_dialect->describeColumns(table, schema), Db::FETCH_NUM) {
+		for field in fields {
 
 			/**
 			 * By default the bind types is two
@@ -399,4 +437,30 @@ class Mysql extends PdoAdapter
 
 		return this->{"execute"}(this->_dialect->addForeignKey(tableName, schemaName, reference));
 	}
+
+	/**
+	 * Sends a SELECT statement to the database server using an unbuffered query.
+	 * No other statement can be sent through the connection until all the rows
+	 * of the returned result have been fetched
+	 */
+	public function queryStream(string! sqlStatement, var bindParams = null, var bindTypes = null) -> <ResultInterface> | boolean
+	{
+		var pdo, buffered, result, e;
+
+		let pdo = <\Pdo> this->_pdo,
+			buffered = pdo->getAttribute(\Pdo::MYSQL_ATTR_USE_BUFFERED_QUERY);
+
+		pdo->setAttribute(\Pdo::MYSQL_ATTR_USE_BUFFERED_QUERY, false);
+
+		try {
+			let result = parent::queryStream(sqlStatement, bindParams, bindTypes);
+		} catch \Exception, e {
+			pdo->setAttribute(\Pdo::MYSQL_ATTR_USE_BUFFERED_QUERY, buffered);
+			throw e;
+		}
+
+		pdo->setAttribute(\Pdo::MYSQL_ATTR_USE_BUFFERED_QUERY, buffered);
+
+		return result;
+	}
 }
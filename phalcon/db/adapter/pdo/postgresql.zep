@@ -20,6 +20,7 @@
 
 namespace Phalcon\Db\Adapter\Pdo;
 
+use Phalcon\Db;
 use Phalcon\Db\Column;
 use Phalcon\Db\RawValue;
 use Phalcon\Db\Adapter\Pdo as PdoAdapter;
@@ -95,17 +96,56 @@ class Postgresql extends PdoAdapter
 	 * </code>
 	 */
 	public function describeColumns(string table, string schema = null) -> <Column[]>
+	{
+		return this->_createColumns(
+			this->fetchAll(this->_dialect->describeColumns(table, schema), \Phalcon\Db::FETCH_NUM)
+		);
+	}
+
+	/**
+	 * Returns the Phalcon\Db\Column objects of every table in a schema
+	 * indexed by table name, using a single query
+	 *
+	 * <code>
+	 * print_r(
+	 *     $connection->describeSchemaColumns("public")
+	 * );
+	 * </code>
+	 */
+	public function describeSchemaColumns(string schema = null) -> array
+	{
+		var field, fields, tableName, table, tables;
+
+		/**
+		 * The table name is the last field of every row
+		 */
+		let fields = [];
+		for field in this->fetchAll(this->_dialect->{"describeSchemaColumns"}(schema), \Phalcon\Db::FETCH_NUM) {
+			let tableName = field[10];
+			unset field[10];
+			let fields[tableName][] = field;
+		}
+
+		let tables = [];
+		for tableName, table in fields {
+			let tables[tableName] = this->_createColumns(table);
+		}
+
+		return tables;
+	}
+
+	/**
+	 * Creates the Phalcon\Db\Column objects from the rows describing a table
+	 * 0:name, 1:type, 2:size, 3:numericsize, 4: numericscale, 5: null, 6: key, 7: extra, 8: position, 9 default
+	 */
+	protected function _createColumns(array! fields) -> <Column[]>
 	{
 		var columns, columnType, field, definition,
 			oldColumn, columnName, charSize, numericSize, numericScale;
 
 		let oldColumn = null, columns = [];
 
-		/**
-		 * We're using FETCH_NUM to fetch the columns
-		 * 0:name, 1:type, 2:size, 3:numericsize, 4: numericscale, 5: null, 6: key, 7: extra, 8: position, 9 default
-		 */
-		for field in this->fetchAll(this->_dialect->describeColumns(table, schema), \Phalcon\Db::FETCH_NUM) {
+		for field in fields {
 
 			/**
 			 * By default the bind types is two
@@ -398,4 +438,35 @@ class Postgresql extends PdoAdapter
 	{
 		return true;
 	}
+
+	/**
+	 * Executes a multi-row INSERT statement with a RETURNING clause to read
+	 * the generated identities
+	 */
+	protected function _executeInsertReturningIds(array! statement, int rowCount, string! identityField) -> array | boolean
+	{
+		var sql, rows;
+
+		let sql = statement[0] . " RETURNING " . this->escapeIdentifier(identityField);
+
+		if !count(statement[2]) {
+			let rows = this->fetchAll(sql, Db::FETCH_NUM, statement[1]);
+		} else {
+			let rows = this->fetchAll(sql, Db::FETCH_NUM, statement[1], statement[2]);
+		}
+
+		if count(rows) != rowCount {
+			return false;
+		}
+
+		return array_column(rows, 0);
+	}
+
+	/**
+	 * Streaming statements fetch the rows through a server-side cursor
+	 */
+	protected function getStreamingOptions() -> array
+	{
+		return [\Pdo::ATTR_CURSOR: \Pdo::CURSOR_SCROLL];
+	}
 }
@@ -394,4 +394,31 @@ class Sqlite extends PdoAdapter
 	{
 		return new RawValue("NULL");
 	}
+
+	/**
+	 * Executes a multi-row INSERT statement and returns the generated
+	 * identities. SQLite returns the identity of the last row, the rows of
+	 * a single statement get consecutive identities
+	 */
+	protected function _executeInsertReturningIds(array! statement, int rowCount, string! identityField) -> array | boolean
+	{
+		var success, lastId;
+
+		if !count(statement[2]) {
+			let success = this->execute(statement[0], statement[1]);
+		} else {
+			let success = this->execute(statement[0], statement[1], statement[2]);
+		}
+
+		if !success {
+			return false;
+		}
+
+		let lastId = this->lastInsertId();
+		if !lastId {
+			return false;
+		}
+
+		return range((int) lastId - rowCount + 1, (int) lastId);
+	}
 }
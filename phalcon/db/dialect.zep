@@ -145,6 +145,47 @@ abstract class Dialect implements DialectInterface
 		return sqlQuery . " FOR UPDATE";
 	}
 
+	/**
+	 * Returns an INSERT statement modified to update the given fields when
+	 * the row conflicts with an existing one
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function upsert(string! insertSql, array! updateFields, array! conflictFields = []) -> string
+	{
+		throw new Exception("Upserts are not supported by this dialect");
+	}
+
+	/**
+	 * Appends the ON CONFLICT clause used by the dialects following the
+	 * PostgreSQL syntax
+	 */
+	protected final function getUpsertOnConflict(string! insertSql, array! updateFields, array! conflictFields) -> string
+	{
+		var field, escapedField, conflicts, updates;
+
+		if !count(conflictFields) {
+			throw new Exception("The conflicting fields are required");
+		}
+
+		let conflicts = [];
+		for field in conflictFields {
+			let conflicts[] = this->escape(field);
+		}
+
+		if !count(updateFields) {
+			return insertSql . " ON CONFLICT (" . join(", ", conflicts) . ") DO NOTHING";
+		}
+
+		let updates = [];
+		for field in updateFields {
+			let escapedField = this->escape(field),
+				updates[] = escapedField . " = EXCLUDED." . escapedField;
+		}
+
+		return insertSql . " ON CONFLICT (" . join(", ", conflicts) . ") DO UPDATE SET " . join(", ", updates);
+	}
+
 	/**
 	 * Returns a SQL modified with a LOCK IN SHARE MODE clause
 	 *
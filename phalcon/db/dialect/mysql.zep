@@ -610,6 +610,32 @@ class Mysql extends Dialect
 		return "SELECT IF(COUNT(*) > 0, 1, 0) FROM `INFORMATION_SCHEMA`.`VIEWS` WHERE `TABLE_NAME`='" . viewName . "' AND `TABLE_SCHEMA` = DATABASE()";
 	}
 
+	/**
+	 * Returns an INSERT statement modified with an ON DUPLICATE KEY UPDATE
+	 * clause, the conflicts are detected by MySQL using the unique indexes
+	 *
+	 *<code>
+	 * $sql = $dialect->upsert("INSERT INTO robots (id, name) VALUES (?, ?)", ["name"]);
+	 * echo $sql; // INSERT INTO robots (id, name) VALUES (?, ?) ON DUPLICATE KEY UPDATE `name` = VALUES(`name`)
+	 *</code>
+	 */
+	public function upsert(string! insertSql, array! updateFields, array! conflictFields = []) -> string
+	{
+		var field, escapedField, updates;
+
+		if !count(updateFields) {
+			throw new Exception("The fields to update are required");
+		}
+
+		let updates = [];
+		for field in updateFields {
+			let escapedField = this->escape(field),
+				updates[] = escapedField . " = VALUES(" . escapedField . ")";
+		}
+
+		return insertSql . " ON DUPLICATE KEY UPDATE " . join(", ", updates);
+	}
+
 	/**
 	 * Generates SQL describing a table
 	 *
@@ -624,6 +650,29 @@ class Mysql extends Dialect
 		return "DESCRIBE " . this->prepareTable(table, schema);
 	}
 
+	/**
+	 * Generates SQL describing the columns of every table in a schema, the
+	 * fields are the same as in describeColumns() plus the table name
+	 *
+	 * <code>
+	 * print_r(
+	 *     $dialect->describeSchemaColumns("blog")
+	 * );
+	 * </code>
+	 */
+	public function describeSchemaColumns(string schema = null) -> string
+	{
+		var condition;
+
+		if schema {
+			let condition = "'" . schema . "'";
+		} else {
+			let condition = "DATABASE()";
+		}
+
+		return "SELECT `COLUMN_NAME`, `COLUMN_TYPE`, `IS_NULLABLE`, `COLUMN_KEY`, `COLUMN_DEFAULT`, `EXTRA`, `TABLE_NAME` FROM `INFORMATION_SCHEMA`.`COLUMNS` WHERE `TABLE_SCHEMA` = " . condition . " ORDER BY `TABLE_NAME`, `ORDINAL_POSITION`";
+	}
+
 	/**
 	 * List all tables in database
 	 *
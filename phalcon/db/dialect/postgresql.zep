@@ -561,6 +561,19 @@ class Postgresql extends Dialect
 		return "SELECT CASE WHEN COUNT(*) > 0 THEN 1 ELSE 0 END FROM pg_views WHERE viewname='" . viewName . "' AND schemaname='public'";
 	}
 
+	/**
+	 * Returns an INSERT statement modified with an ON CONFLICT clause
+	 *
+	 *<code>
+	 * $sql = $dialect->upsert("INSERT INTO robots (id, name) VALUES (?, ?)", ["name"], ["id"]);
+	 * echo $sql; // INSERT INTO robots (id, name) VALUES (?, ?) ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"
+	 *</code>
+	 */
+	public function upsert(string! insertSql, array! updateFields, array! conflictFields = []) -> string
+	{
+		return this->getUpsertOnConflict(insertSql, updateFields, conflictFields);
+	}
+
 	/**
 	 * Generates SQL describing a table
 	 *
@@ -578,6 +591,25 @@ class Postgresql extends Dialect
 		return "SELECT DISTINCT c.column_name AS Field, c.data_type AS Type, c.character_maximum_length AS Size, c.numeric_precision AS NumericSize, c.numeric_scale AS NumericScale, c.is_nullable AS Null, CASE WHEN pkc.column_name NOTNULL THEN 'PRI' ELSE '' END AS Key, CASE WHEN c.data_type LIKE '%int%' AND c.column_default LIKE '%nextval%' THEN 'auto_increment' ELSE '' END AS Extra, c.ordinal_position AS Position, c.column_default FROM information_schema.columns c LEFT JOIN ( SELECT kcu.column_name, kcu.table_name, kcu.table_schema FROM information_schema.table_constraints tc INNER JOIN information_schema.key_column_usage kcu on (kcu.constraint_name = tc.constraint_name and kcu.table_name=tc.table_name and kcu.table_schema=tc.table_schema) WHERE tc.constraint_type='PRIMARY KEY') pkc ON (c.column_name=pkc.column_name AND c.table_schema = pkc.table_schema AND c.table_name=pkc.table_name) WHERE c.table_schema='public' AND c.table_name='" . table . "' ORDER BY c.ordinal_position";
 	}
 
+	/**
+	 * Generates SQL describing the columns of every table in a schema, the
+	 * fields are the same as in describeColumns() plus the table name
+	 *
+	 * <code>
+	 * print_r(
+	 *     $dialect->describeSchemaColumns("public")
+	 * );
+	 * </code>
+	 */
+	public function describeSchemaColumns(string schema = null) -> string
+	{
+		if !schema {
+			let schema = "public";
+		}
+
+		return "SELECT DISTINCT c.column_name AS Field, c.data_type AS Type, c.character_maximum_length AS Size, c.numeric_precision AS NumericSize, c.numeric_scale AS NumericScale, c.is_nullable AS Null, CASE WHEN pkc.column_name NOTNULL THEN 'PRI' ELSE '' END AS Key, CASE WHEN c.data_type LIKE '%int%' AND c.column_default LIKE '%nextval%' THEN 'auto_increment' ELSE '' END AS Extra, c.ordinal_position AS Position, c.column_default, c.table_name AS TableName FROM information_schema.columns c LEFT JOIN ( SELECT kcu.column_name, kcu.table_name, kcu.table_schema FROM information_schema.table_constraints tc INNER JOIN information_schema.key_column_usage kcu on (kcu.constraint_name = tc.constraint_name and kcu.table_name=tc.table_name and kcu.table_schema=tc.table_schema) WHERE tc.constraint_type='PRIMARY KEY') pkc ON (c.column_name=pkc.column_name AND c.table_schema = pkc.table_schema AND c.table_name=pkc.table_name) WHERE c.table_schema='" . schema . "' ORDER BY c.table_name, c.ordinal_position";
+	}
+
 	/**
 	 * List all tables in database
 	 *
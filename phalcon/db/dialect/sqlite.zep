@@ -509,6 +509,19 @@ class Sqlite extends Dialect
 		return "SELECT CASE WHEN COUNT(*) > 0 THEN 1 ELSE 0 END FROM sqlite_master WHERE type='view' AND tbl_name='" . viewName . "'";
 	}
 
+	/**
+	 * Returns an INSERT statement modified with an ON CONFLICT clause
+	 *
+	 *<code>
+	 * $sql = $dialect->upsert("INSERT INTO robots (id, name) VALUES (?, ?)", ["name"], ["id"]);
+	 * echo $sql; // INSERT INTO robots (id, name) VALUES (?, ?) ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"
+	 *</code>
+	 */
+	public function upsert(string! insertSql, array! updateFields, array! conflictFields = []) -> string
+	{
+		return this->getUpsertOnConflict(insertSql, updateFields, conflictFields);
+	}
+
 	/**
 	 * Generates SQL describing a table
 	 *
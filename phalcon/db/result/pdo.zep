@@ -20,6 +20,7 @@
 namespace Phalcon\Db\Result;
 
 use Phalcon\Db;
+use Phalcon\Db\Exception;
 use Phalcon\Db\ResultInterface;
 
 %{
@@ -55,6 +56,12 @@ class Pdo implements ResultInterface
 	 */
 	protected _fetchMode = Db::FETCH_OBJ;
 
+	/**
+	 * Arguments of the active fetch mode, applied again to the statements
+	 * prepared by dataSeek()
+	 */
+	protected _fetchModeArgs = null;
+
 	/**
 	 * Internal resultset
 	 *
@@ -70,6 +77,11 @@ class Pdo implements ResultInterface
 
 	protected _rowCount = false;
 
+	/**
+	 * Whether the statement was given back to the connection
+	 */
+	protected _released = false;
+
 	/**
 	 * Phalcon\Db\Result\Pdo constructor
 	 *
@@ -103,6 +115,14 @@ class Pdo implements ResultInterface
 	 */
 	public function execute() -> boolean
 	{
+		/**
+		 * A released statement may be executing another query, so a new one is prepared
+		 */
+		if this->_released {
+			this->dataSeek(0);
+			return true;
+		}
+
 		return this->_pdoStatement->execute();
 	}
 
@@ -124,7 +144,18 @@ class Pdo implements ResultInterface
 	 */
 	public function $fetch(var fetchStyle = null, var cursorOrientation = null, var cursorOffset = null)
 	{
-		return this->_pdoStatement->$fetch(fetchStyle, cursorOrientation, cursorOffset);
+		var row;
+
+		if this->_released {
+			return false;
+		}
+
+		let row = this->_pdoStatement->$fetch(fetchStyle, cursorOrientation, cursorOffset);
+		if row === false {
+			this->releaseStatement();
+		}
+
+		return row;
 	}
 
 	/**
@@ -145,7 +176,18 @@ class Pdo implements ResultInterface
 	 */
 	public function fetchArray()
 	{
-		return this->_pdoStatement->$fetch();
+		var row;
+
+		if this->_released {
+			return false;
+		}
+
+		let row = this->_pdoStatement->$fetch();
+		if row === false {
+			this->releaseStatement();
+		}
+
+		return row;
 	}
 
 	/**
@@ -162,28 +204,30 @@ class Pdo implements ResultInterface
 	 */
 	public function fetchAll(var fetchStyle = null, var fetchArgument = null, var ctorArgs = null) -> array
 	{
-		var pdoStatement;
+		var pdoStatement, rows;
+
+		if this->_released {
+			return [];
+		}
 
 		let pdoStatement = this->_pdoStatement;
 
 		if typeof fetchStyle == "integer" {
 
 			if fetchStyle == Db::FETCH_CLASS {
-				return pdoStatement->fetchAll(fetchStyle, fetchArgument, ctorArgs);
-			}
-
-			if fetchStyle == Db::FETCH_COLUMN {
-				return pdoStatement->fetchAll(fetchStyle, fetchArgument);
+				let rows = pdoStatement->fetchAll(fetchStyle, fetchArgument, ctorArgs);
+			} elseif fetchStyle == Db::FETCH_COLUMN || fetchStyle == Db::FETCH_FUNC {
+				let rows = pdoStatement->fetchAll(fetchStyle, fetchArgument);
+			} else {
+				let rows = pdoStatement->fetchAll(fetchStyle);
 			}
-
-			if fetchStyle == Db::FETCH_FUNC {
-				return pdoStatement->fetchAll(fetchStyle, fetchArgument);
-			}
-
-			return pdoStatement->fetchAll(fetchStyle);
+		} else {
+			let rows = pdoStatement->fetchAll();
 		}
 
-		return pdoStatement->fetchAll();
+		this->releaseStatement();
+
+		return rows;
 	}
 
 	/**
@@ -209,9 +253,10 @@ class Pdo implements ResultInterface
 				type = connection->getType();
 
 			/**
-			 * MySQL library properly returns the number of records PostgreSQL too
+			 * MySQL library properly returns the number of records PostgreSQL too,
+			 * the count is read before the statement is released
 			 */
-			if type == "mysql" || type == "pgsql" {
+			if (type == "mysql" || type == "pgsql") && !this->_released {
 				let pdoStatement = this->_pdoStatement,
 					rowCount = pdoStatement->rowCount();
 			}
@@ -277,6 +322,11 @@ class Pdo implements ResultInterface
 		var connection, pdo, sqlStatement, bindParams, statement;
 		long n;
 
+		/**
+		 * The current statement is not read anymore
+		 */
+		this->releaseStatement();
+
 		let connection = this->_connection,
 			pdo = connection->getInternalHandler(),
 			sqlStatement = this->_sqlStatement,
@@ -294,7 +344,12 @@ class Pdo implements ResultInterface
 			let statement = pdo->query(sqlStatement);
 		}
 
-		let this->_pdoStatement = statement;
+		let this->_pdoStatement = statement,
+			this->_released = false;
+
+		if typeof this->_fetchModeArgs == "array" {
+			call_user_func_array([statement, "setFetchMode"], this->_fetchModeArgs);
+		}
 
 		let n = -1, number--;
 		while n != number {
@@ -330,46 +385,83 @@ class Pdo implements ResultInterface
 	 */
 	public function setFetchMode(int fetchMode, var colNoOrClassNameOrObject = null, var ctorargs = null) -> boolean
 	{
-		var pdoStatement;
-
-		let pdoStatement = this->_pdoStatement;
+		var args;
 
 		if fetchMode == Db::FETCH_CLASS {
-			if pdoStatement->setFetchMode(fetchMode, colNoOrClassNameOrObject, ctorargs) {
-				let this->_fetchMode = fetchMode;
-				return true;
-			}
-			return false;
+			let args = [fetchMode, colNoOrClassNameOrObject, ctorargs];
+		} elseif fetchMode == Db::FETCH_INTO || fetchMode == Db::FETCH_COLUMN {
+			let args = [fetchMode, colNoOrClassNameOrObject];
+		} else {
+			let args = [fetchMode];
 		}
 
-		if fetchMode == Db::FETCH_INTO {
-			if pdoStatement->setFetchMode(fetchMode, colNoOrClassNameOrObject) {
-				let this->_fetchMode = fetchMode;
-				return true;
+		/**
+		 * A released statement may belong to another query now, the mode is
+		 * applied once the statement is prepared again
+		 */
+		if !this->_released {
+			if !call_user_func_array([this->_pdoStatement, "setFetchMode"], args) {
+				return false;
 			}
-			return false;
 		}
 
-		if fetchMode == Db::FETCH_COLUMN {
-			if pdoStatement->setFetchMode(fetchMode, colNoOrClassNameOrObject) {
-				let this->_fetchMode = fetchMode;
-				return true;
+		let this->_fetchMode = fetchMode,
+			this->_fetchModeArgs = args;
+
+		return true;
+	}
+
+	/**
+	 * Gives the statement back to the connection so it can be reused by
+	 * other queries
+	 */
+	protected function releaseStatement() -> void
+	{
+		var connection, type;
+
+		if this->_released {
+			return;
+		}
+
+		let connection = this->_connection;
+
+		/**
+		 * The statement can't be read once it's given back, the number of
+		 * rows is kept for numRows()
+		 */
+		if this->_rowCount === false {
+			let type = connection->getType();
+			if type == "mysql" || type == "pgsql" {
+				let this->_rowCount = this->_pdoStatement->rowCount();
 			}
-			return false;
 		}
 
-		if pdoStatement->setFetchMode(fetchMode) {
-			let this->_fetchMode = fetchMode;
-			return true;
+		let this->_released = true;
+
+		if connection instanceof \Phalcon\Db\Adapter\Pdo {
+			connection->releaseStatement(this->_pdoStatement);
 		}
-		return false;
 	}
 
 	/**
-	 * Gets the internal PDO result object
+	 * Releases the statement when the result is freed
+	 */
+	public function __destruct()
+	{
+		this->releaseStatement();
+	}
+
+	/**
+	 * Gets the internal PDO result object. Once every row is fetched the
+	 * statement is given back to the connection and can't be accessed, call
+	 * execute() to prepare it again
 	 */
 	public function getInternalResult() -> <\PDOStatement>
 	{
+		if this->_released {
+			throw new Exception("The statement was released after fetching every row, execute() must be called first");
+		}
+
 		return this->_pdoStatement;
 	}
 }
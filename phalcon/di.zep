@@ -88,6 +88,21 @@ class Di implements DiInterface
 	 */
 	protected _eventsManager;
 
+	/**
+	 * Whether the service definitions are compiled
+	 */
+	protected _compiled = false;
+
+	/**
+	 * Whether resolution counts and times are collected
+	 */
+	protected _collectStats = false;
+
+	/**
+	 * Resolution counts and times by service name
+	 */
+	protected _stats = [];
+
 	/**
 	 * Latest DI build
 	 */
@@ -129,6 +144,11 @@ class Di implements DiInterface
 		var service;
 		let service = new Service(name, definition, shared),
 			this->_services[name] = service;
+
+		if this->_compiled {
+			service->compile();
+		}
+
 		return service;
 	}
 
@@ -162,6 +182,11 @@ class Di implements DiInterface
 		if !isset this->_services[name] {
 			let service = new Service(name, definition, shared),
 				this->_services[name] = service;
+
+			if this->_compiled {
+				service->compile();
+			}
+
 			return service;
 		}
 
@@ -210,7 +235,11 @@ class Di implements DiInterface
 	 */
 	public function get(string! name, parameters = null) -> var
 	{
-		var service, eventsManager, instance = null;
+		var service, eventsManager, instance = null, start, stats;
+
+		if this->_collectStats {
+			let start = microtime(true);
+		}
 
 		let eventsManager = <ManagerInterface> this->_eventsManager;
 
@@ -265,9 +294,88 @@ class Di implements DiInterface
 			);
 		}
 
+		if this->_collectStats {
+			if fetch stats, this->_stats[name] {
+				let this->_stats[name] = [
+					"resolutions": stats["resolutions"] + 1,
+					"time":        stats["time"] + microtime(true) - start
+				];
+			} else {
+				let this->_stats[name] = [
+					"resolutions": 1,
+					"time":        microtime(true) - start
+				];
+			}
+		}
+
 		return instance;
 	}
 
+	/**
+	 * Compiles the class name and array definitions of the registered services
+	 * into injection plans, so resolving them doesn't interpret the definitions
+	 * again. Services registered afterwards are compiled as they are set
+	 *
+	 *<code>
+	 * $di->loadFromPhp("path/services.php");
+	 *
+	 * $di->compile();
+	 *</code>
+	 */
+	public function compile() -> <Di>
+	{
+		var service;
+
+		if typeof this->_services == "array" {
+			for service in this->_services {
+				if service instanceof Service {
+					service->compile();
+				}
+			}
+		}
+
+		let this->_compiled = true;
+
+		return this;
+	}
+
+	/**
+	 * Checks whether the service definitions are compiled
+	 */
+	public function isCompiled() -> boolean
+	{
+		return this->_compiled;
+	}
+
+	/**
+	 * Tells the DI to collect the number of times every service is resolved and
+	 * the time spent resolving it
+	 */
+	public function collectStats(boolean collect) -> <Di>
+	{
+		let this->_collectStats = collect;
+		return this;
+	}
+
+	/**
+	 * Returns the number of resolutions and the time in seconds spent resolving
+	 * every service since the stats started to be collected
+	 *
+	 *<code>
+	 * $di->collectStats(true);
+	 *
+	 * // ...
+	 *
+	 * foreach ($di->getStats() as $name => $stats) {
+	 *     echo $name, ": ", $stats["resolutions"], " ", $stats["time"], PHP_EOL;
+	 * }
+	 *</code>
+	 */
+	public function getStats() -> array
+	{
+		return this->_stats;
+	}
+
 	/**
 	 * Resolves a service, the resolved service is stored in the DI, subsequent
 	 * requests for this service will return the same instance
@@ -51,6 +51,13 @@ class Service implements ServiceInterface
 
 	protected _sharedInstance;
 
+	/**
+	 * Injection plan of class name and array definitions built by compile()
+	 */
+	protected _plan;
+
+	protected _builder;
+
 	/**
 	 * Phalcon\Di\Service
 	 *
@@ -106,7 +113,8 @@ class Service implements ServiceInterface
 	 */
 	public function setDefinition(definition) -> void
 	{
-		let this->_definition = definition;
+		let this->_definition = definition,
+			this->_plan = null;
 	}
 
 	/**
@@ -146,6 +154,22 @@ class Service implements ServiceInterface
 		let found = true,
 			instance = null;
 
+		/**
+		 * Compiled definitions are built straight from their plan
+		 */
+		if this->_plan !== null {
+			let builder = <Builder> this->_builder,
+				instance = builder->buildCompiled(dependencyInjector, this->_plan, parameters);
+
+			if shared {
+				let this->_sharedInstance = instance;
+			}
+
+			let this->_resolved = true;
+
+			return instance;
+		}
+
 		let definition = this->_definition;
 		if typeof definition == "string" {
 
@@ -220,6 +244,41 @@ class Service implements ServiceInterface
 		return instance;
 	}
 
+	/**
+	 * Compiles class name and array definitions into an injection plan, so
+	 * resolving the service doesn't need to interpret the definition again.
+	 * Returns false if the definition can't be compiled
+	 */
+	public function compile() -> boolean
+	{
+		var definition, builder;
+
+		let definition = this->_definition;
+
+		if typeof definition == "string" {
+			if !class_exists(definition) {
+				return false;
+			}
+			let definition = ["className": definition];
+		} elseif typeof definition != "array" {
+			return false;
+		}
+
+		let builder = new Builder(),
+			this->_plan = builder->compile(definition),
+			this->_builder = builder;
+
+		return true;
+	}
+
+	/**
+	 * Returns true if the service definition was compiled
+	 */
+	public function isCompiled() -> boolean
+	{
+		return this->_plan !== null;
+	}
+
 	/**
 	 * Changes a parameter in the definition without resolve the service
 	 */
@@ -249,7 +308,8 @@ class Service implements ServiceInterface
 		/**
 		 * Re-update the definition
 		 */
-		let this->_definition = definition;
+		let this->_definition = definition,
+			this->_plan = null;
 
 		return this;
 	}
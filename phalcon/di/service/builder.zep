@@ -30,6 +30,12 @@ use Phalcon\Di\Exception;
 class Builder
 {
 
+	const ARGUMENT_SERVICE = 0;
+
+	const ARGUMENT_PARAMETER = 1;
+
+	const ARGUMENT_INSTANCE = 2;
+
 	/**
 	 * Resolves a constructor/call parameter
 	 *
@@ -284,4 +290,253 @@ class Builder
 
 		return instance;
 	}
+
+	/**
+	 * Validates a complex service definition and turns it into a plan of
+	 * constructor, setter and property injections that buildCompiled()
+	 * executes without interpreting the definition again
+	 *
+	 * @param array definition
+	 * @return array
+	 */
+	public function compile(array! definition) -> array
+	{
+		var className, arguments, paramCalls, methodPosition, method, methodName,
+			calls, propertyPosition, property, propertyName, propertyValue, properties;
+
+		/**
+		 * The class name is required
+		 */
+		if !fetch className, definition["className"] {
+			throw new Exception("Invalid service definition. Missing 'className' parameter");
+		}
+
+		let calls = [];
+		if fetch paramCalls, definition["calls"] {
+
+			if typeof paramCalls != "array" {
+				throw new Exception("Setter injection parameters must be an array");
+			}
+
+			for methodPosition, method in paramCalls {
+
+				if typeof method != "array" {
+					throw new Exception("Method call must be an array on position " . methodPosition);
+				}
+
+				if !fetch methodName, method["method"] {
+					throw new Exception("The method name is required on position " . methodPosition);
+				}
+
+				if fetch arguments, method["arguments"] {
+					if typeof arguments != "array" {
+						throw new Exception("Call arguments must be an array " . methodPosition);
+					}
+					let calls[] = [methodName, this->_compileParameters(arguments)];
+				} else {
+					let calls[] = [methodName, []];
+				}
+			}
+		}
+
+		let properties = [];
+		if fetch paramCalls, definition["properties"] {
+
+			if typeof paramCalls != "array" {
+				throw new Exception("Setter injection parameters must be an array");
+			}
+
+			for propertyPosition, property in paramCalls {
+
+				if typeof property != "array" {
+					throw new Exception("Property must be an array on position " . propertyPosition);
+				}
+
+				if !fetch propertyName, property["name"] {
+					throw new Exception("The property name is required on position " . propertyPosition);
+				}
+
+				if !fetch propertyValue, property["value"] {
+					throw new Exception("The property value is required on position " . propertyPosition);
+				}
+
+				let properties[] = [propertyName, this->_compileParameter(propertyPosition, propertyValue)];
+			}
+		}
+
+		if fetch arguments, definition["arguments"] {
+			let arguments = this->_compileParameters(arguments);
+		} else {
+			let arguments = null;
+		}
+
+		return [
+			"className":  className,
+			"arguments":  arguments,
+			"calls":      calls,
+			"properties": properties
+		];
+	}
+
+	/**
+	 * Builds a service using a plan returned by compile()
+	 *
+	 * @param \Phalcon\DiInterface dependencyInjector
+	 * @param array plan
+	 * @param array parameters
+	 * @return mixed
+	 */
+	public function buildCompiled(<DiInterface> dependencyInjector, array! plan, parameters = null)
+	{
+		var className, arguments, calls, call, properties, property, instance;
+
+		let className = plan["className"];
+
+		if typeof parameters == "array" {
+
+			/**
+			 * Build the instance overriding the definition constructor parameters
+			 */
+			if count(parameters) {
+				let instance = create_instance_params(className, parameters);
+			} else {
+				let instance = create_instance(className);
+			}
+
+		} else {
+
+			let arguments = plan["arguments"];
+			if typeof arguments == "array" {
+				let instance = create_instance_params(className, this->_resolveParameters(dependencyInjector, arguments));
+			} else {
+				let instance = create_instance(className);
+			}
+		}
+
+		let calls = plan["calls"];
+		if count(calls) {
+
+			if typeof instance != "object" {
+				throw new Exception(
+					"The definition has setter injection parameters but the constructor didn't return an instance"
+				);
+			}
+
+			for call in calls {
+				if count(call[1]) {
+					call_user_func_array([instance, call[0]], this->_resolveParameters(dependencyInjector, call[1]));
+				} else {
+					call_user_func([instance, call[0]]);
+				}
+			}
+		}
+
+		let properties = plan["properties"];
+		if count(properties) {
+
+			if typeof instance != "object" {
+				throw new Exception(
+					"The definition has properties injection parameters but the constructor didn't return an instance"
+				);
+			}
+
+			for property in properties {
+				let instance->{property[0]} = this->_resolveParameter(dependencyInjector, property[1]);
+			}
+		}
+
+		return instance;
+	}
+
+	/**
+	 * Validates a constructor/call parameter and turns it into a plan entry
+	 */
+	private function _compileParameter(int position, array! argument) -> array
+	{
+		var type, name, value, instanceArguments;
+
+		/**
+		 * All the arguments must have a type
+		 */
+		if !fetch type, argument["type"] {
+			throw new Exception("Argument at position " . position . " must have a type");
+		}
+
+		switch type {
+
+			case "service":
+				if !fetch name, argument["name"] {
+					throw new Exception("Service 'name' is required in parameter on position " . position);
+				}
+				return [self::ARGUMENT_SERVICE, name];
+
+			case "parameter":
+				if !fetch value, argument["value"] {
+					throw new Exception("Service 'value' is required in parameter on position " . position);
+				}
+				return [self::ARGUMENT_PARAMETER, value];
+
+			case "instance":
+				if !fetch name, argument["className"] {
+					throw new Exception("Service 'className' is required in parameter on position " . position);
+				}
+				if !fetch instanceArguments, argument["arguments"] {
+					let instanceArguments = null;
+				}
+				return [self::ARGUMENT_INSTANCE, name, instanceArguments];
+
+			default:
+				throw new Exception("Unknown service type in parameter on position " . position);
+		}
+	}
+
+	/**
+	 * Validates an array of parameters and turns it into plan entries
+	 */
+	private function _compileParameters(array! arguments) -> array
+	{
+		var position, argument, compiledArguments;
+
+		let compiledArguments = [];
+		for position, argument in arguments {
+			let compiledArguments[] = this->_compileParameter(position, argument);
+		}
+		return compiledArguments;
+	}
+
+	/**
+	 * Resolves a parameter plan entry
+	 *
+	 * @return mixed
+	 */
+	private function _resolveParameter(<DiInterface> dependencyInjector, array! argument)
+	{
+		if argument[0] === self::ARGUMENT_PARAMETER {
+			return argument[1];
+		}
+
+		if typeof dependencyInjector != "object" {
+			throw new Exception("The dependency injector container is not valid");
+		}
+
+		if argument[0] === self::ARGUMENT_SERVICE {
+			return dependencyInjector->get(argument[1]);
+		}
+
+		return dependencyInjector->get(argument[1], argument[2]);
+	}
+
+	/**
+	 * Resolves an array of parameter plan entries
+	 */
+	private function _resolveParameters(<DiInterface> dependencyInjector, array! arguments) -> array
+	{
+		var argument, buildArguments;
+
+		let buildArguments = [];
+		for argument in arguments {
+			let buildArguments[] = this->_resolveParameter(dependencyInjector, argument);
+		}
+		return buildArguments;
+	}
 }
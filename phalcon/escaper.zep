@@ -172,6 +172,16 @@ class Escaper implements EscaperInterface
 	 */
 	public function escapeCss(string css) -> string
 	{
+		var escaped;
+
+		/**
+		 * UTF-8 strings are escaped directly
+		 */
+		let escaped = phalcon_escape_css_utf8(css);
+		if typeof escaped == "string" {
+			return escaped;
+		}
+
 		/**
 		 * Normalize encoding to UTF-32
 		 * Escape the string
@@ -184,6 +194,16 @@ class Escaper implements EscaperInterface
 	 */
 	public function escapeJs(string js) -> string
 	{
+		var escaped;
+
+		/**
+		 * UTF-8 strings are escaped directly
+		 */
+		let escaped = phalcon_escape_js_utf8(js);
+		if typeof escaped == "string" {
+			return escaped;
+		}
+
 		/**
 		 * Normalize encoding to UTF-32
 		 * Escape the string
@@ -41,6 +41,12 @@ class Manager implements ManagerInterface
 
 	protected _responses;
 
+	/**
+	 * Handlers resolved for every event type already fired, grouped by the
+	 * queue (event group or event type) they were attached to
+	 */
+	protected _dispatchTables = [];
+
 	/**
 	 * Attach a listener to the events manager
 	 *
@@ -56,6 +62,8 @@ class Manager implements ManagerInterface
 			throw new Exception("Event handler must be an Object");
 		}
 
+		let this->_dispatchTables = [];
+
 		if !fetch priorityQueue, this->_events[eventType] {
 
 			if this->_enablePriorities {
@@ -99,6 +107,8 @@ class Manager implements ManagerInterface
 			throw new Exception("Event handler must be an Object");
 		}
 
+		let this->_dispatchTables = [];
+
 		if fetch priorityQueue, this->_events[eventType] {
 
 			if typeof priorityQueue == "object" {
@@ -178,6 +188,8 @@ class Manager implements ManagerInterface
 	 */
 	public function detachAll(string! type = null)
 	{
+		let this->_dispatchTables = [];
+
 		if type === null {
 			let this->_events = null;
 		} else {
@@ -375,56 +387,196 @@ class Manager implements ManagerInterface
 	 */
 	public function fire(string! eventType, source, data = null, boolean cancelable = true)
 	{
-		var events, eventParts, type, eventName, event, status, fireEvents;
+		var dispatchTable;
 
-		let events = this->_events;
-		if typeof events != "array" {
+		if typeof this->_events != "array" {
 			return null;
 		}
 
-		// All valid events must have a colon separator
-		if !memstr(eventType, ":") {
-			throw new Exception("Invalid event type " . eventType);
+		// Responses must be traced?
+		if this->_collect {
+			let this->_responses = null;
+		}
+
+		if !fetch dispatchTable, this->_dispatchTables[eventType] {
+			let dispatchTable = this->getDispatchTable(eventType);
+		}
+
+		// Nobody is listening, so there is no need to create the event
+		if !count(dispatchTable) {
+			return null;
 		}
 
-		let eventParts = explode(":", eventType),
-			type = eventParts[0],
-			eventName = eventParts[1];
+		return this->fireDispatchTable(dispatchTable, eventType, source, data, cancelable);
+	}
+
+	/**
+	 * Fires an event in the events manager building its data only when at least
+	 * one listener is attached to it. The data builder is called with no arguments
+	 *
+	 *<code>
+	 *	$eventsManager->fireLazy(
+	 *		"db:beforeQuery",
+	 *		$connection,
+	 *		function () use ($connection) {
+	 *			return $connection->getSQLVariables();
+	 *		}
+	 *	);
+	 *</code>
+	 *
+	 * @param string eventType
+	 * @param object source
+	 * @param callable dataBuilder
+	 * @param boolean cancelable
+	 * @return mixed
+	 */
+	public function fireLazy(string! eventType, source, var dataBuilder = null, boolean cancelable = true)
+	{
+		var dispatchTable, data;
 
-		let status = null;
+		if typeof this->_events != "array" {
+			return null;
+		}
 
 		// Responses must be traced?
 		if this->_collect {
 			let this->_responses = null;
 		}
 
-		let event = null;
+		if !fetch dispatchTable, this->_dispatchTables[eventType] {
+			let dispatchTable = this->getDispatchTable(eventType);
+		}
 
-		// Check if events are grouped by type
-		if fetch fireEvents, events[type] {
+		// Nobody is listening, so neither the event nor its data are built
+		if !count(dispatchTable) {
+			return null;
+		}
 
-			if typeof fireEvents == "object" || typeof fireEvents == "array" {
+		if dataBuilder === null {
+			let data = null;
+		} else {
+			if !is_callable(dataBuilder) {
+				throw new Exception("The event data builder must be callable");
+			}
+			let data = call_user_func(dataBuilder);
+		}
 
-				// Create the event context
-				let event = new Event(eventName, source, data, cancelable);
+		return this->fireDispatchTable(dispatchTable, eventType, source, data, cancelable);
+	}
 
-				// Call the events queue
-				let status = this->fireQueue(fireEvents, event);
+	/**
+	 * Resolves and caches the handlers able to receive an event type: closures
+	 * and listeners implementing a method with the name of the event, taken
+	 * in order from the event group queue and then from the event type queue
+	 */
+	protected function getDispatchTable(string! eventType) -> array
+	{
+		var events, eventParts, eventName, dispatchTable, queueType, queue, iterator, handler, handlers;
+
+		// All valid events must have a colon separator
+		if !memstr(eventType, ":") {
+			throw new Exception("Invalid event type " . eventType);
+		}
+
+		let events = this->_events,
+			eventParts = explode(":", eventType),
+			eventName = eventParts[1],
+			dispatchTable = [];
+
+		for queueType in [eventParts[0], eventType] {
+
+			if !fetch queue, events[queueType] {
+				continue;
+			}
+
+			if typeof queue == "object" {
+				if !(queue instanceof SplPriorityQueue) {
+					throw new Exception(
+						sprintf(
+							"Unexpected value type: expected object of type SplPriorityQueue, %s given",
+							get_class(queue)
+						)
+					);
+				}
+
+				// Extract the handlers in priority order without altering the queue
+				let iterator = clone queue,
+					queue = [];
+
+				iterator->top();
+
+				while iterator->valid() {
+					let queue[] = iterator->current();
+					iterator->next();
+				}
+			} elseif typeof queue != "array" {
+				continue;
+			}
+
+			let handlers = [];
+
+			for handler in queue {
+
+				// Only handler objects are valid
+				if typeof handler != "object" {
+					continue;
+				}
+
+				if handler instanceof \Closure || method_exists(handler, eventName) {
+					let handlers[] = handler;
+				}
+			}
+
+			if count(handlers) {
+				let dispatchTable[] = handlers;
 			}
 		}
 
-		// Check if there are listeners for the event type itself
-		if fetch fireEvents, events[eventType] {
+		let this->_dispatchTables[eventType] = dispatchTable;
+
+		return dispatchTable;
+	}
+
+	/**
+	 * Creates the event context and calls the handlers resolved for its type
+	 */
+	protected function fireDispatchTable(array! dispatchTable, string! eventType, source, data, boolean cancelable)
+	{
+		var status, arguments, eventParts, eventName, event, handlers, handler;
+		boolean collect;
+
+		let status = null,
+			arguments = null,
+			eventParts = explode(":", eventType),
+			eventName = eventParts[1],
+			event = new Event(eventName, source, data, cancelable),
+			collect = (boolean) this->_collect;
+
+		for handlers in dispatchTable {
+
+			for handler in handlers {
 
-			if typeof fireEvents == "object" || typeof fireEvents == "array" {
+				if handler instanceof \Closure {
 
-				// Create the event if it wasn't created before
-				if event === null {
-					let event = new Event(eventName, source, data, cancelable);
+					// Create the closure arguments
+					if arguments === null {
+						let arguments = [event, source, data];
+					}
+
+					let status = call_user_func_array(handler, arguments);
+				} else {
+					let status = handler->{eventName}(event, source, data);
 				}
 
-				// Call the events queue
-				let status = this->fireQueue(fireEvents, event);
+				// Collect the response
+				if collect {
+					let this->_responses[] = status;
+				}
+
+				// Check if the event was stopped by the user
+				if cancelable && event->isStopped() {
+					break;
+				}
 			}
 		}
 
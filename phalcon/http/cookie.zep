@@ -41,6 +41,8 @@ class Cookie implements CookieInterface, InjectionAwareInterface
 
 	protected _useEncryption = false;
 
+	protected _stateless = false;
+
 	protected _dependencyInjector;
 
 	protected _filter;
@@ -262,7 +264,7 @@ class Cookie implements CookieInterface, InjectionAwareInterface
 
 		let dependencyInjector = this->_dependencyInjector;
 
-		if typeof dependencyInjector != "object" {
+		if typeof dependencyInjector != "object" && !this->_stateless {
 			throw new Exception("A dependency injection object is required to access the 'session' service");
 		}
 
@@ -289,9 +291,10 @@ class Cookie implements CookieInterface, InjectionAwareInterface
 		}
 
 		/**
-		 * The definition is stored in session
+		 * The definition is stored in session, stateless cookies only send it
+		 * in the Set-Cookie header
 		 */
-		if count(definition) {
+		if count(definition) && !this->_stateless {
 			let session = <SessionInterface> dependencyInjector->getShared("session");
 			if session->isStarted() {
 				session->set("_PHCOOKIE_" . name, definition);
@@ -354,7 +357,7 @@ class Cookie implements CookieInterface, InjectionAwareInterface
 		if !this->_restored {
 
 			let dependencyInjector = this->_dependencyInjector;
-			if typeof dependencyInjector == "object" {
+			if typeof dependencyInjector == "object" && !this->_stateless {
 
 				let session = dependencyInjector->getShared("session");
 
@@ -405,7 +408,7 @@ class Cookie implements CookieInterface, InjectionAwareInterface
 			httpOnly = this->_httpOnly;
 
 		let dependencyInjector = <DiInterface> this->_dependencyInjector;
-		if typeof dependencyInjector == "object" {
+		if typeof dependencyInjector == "object" && !this->_stateless {
 			let session = <SessionInterface> dependencyInjector->getShared("session");
 			if session->isStarted() {
 				session->remove("_PHCOOKIE_" . name);
@@ -433,6 +436,25 @@ class Cookie implements CookieInterface, InjectionAwareInterface
 		return this->_useEncryption;
 	}
 
+	/**
+	 * Sets if the definition of the cookie is kept out of the session. The
+	 * path, domain, expiration and flags are only sent in the Set-Cookie
+	 * header, so they must be set again to modify or delete the cookie
+	 */
+	public function setStateless(boolean stateless) -> <CookieInterface>
+	{
+		let this->_stateless = stateless;
+		return this;
+	}
+
+	/**
+	 * Check if the definition of the cookie is kept out of the session
+	 */
+	public function isStateless() -> boolean
+	{
+		return this->_stateless;
+	}
+
 	/**
 	 * Sets the cookie's expiration time
 	 */
@@ -79,6 +79,8 @@ class Cookies implements CookiesInterface, InjectionAwareInterface
 
 	protected _useEncryption = true;
 
+	protected _stateless = false;
+
 	protected _cookies;
 
 	/**
@@ -148,6 +150,25 @@ class Cookies implements CookiesInterface, InjectionAwareInterface
 		return this->_useEncryption;
 	}
 
+	/**
+	 * Set if the cookies in the bag keep their definitions out of the
+	 * session, so sending cookies never starts or writes a session
+	 */
+	public function useStateless(boolean stateless) -> <Cookies>
+	{
+		let this->_stateless = stateless;
+		return this;
+	}
+
+	/**
+	 * Returns if the cookies in the bag keep their definitions out of the
+	 * session
+	 */
+	public function isStateless() -> boolean
+	{
+		return this->_stateless;
+	}
+
 	/**
 	 * Sets a cookie to be sent at the end of the request.
 	 *
@@ -195,6 +216,10 @@ class Cookies implements CookiesInterface, InjectionAwareInterface
 			 */
 			cookie->setDi(this->_dependencyInjector);
 
+			if this->_stateless {
+				cookie->{"setStateless"}(true);
+			}
+
 			/**
 			 * Enable encryption in the cookie
 			 */
@@ -270,6 +295,10 @@ class Cookies implements CookiesInterface, InjectionAwareInterface
 			 */
 			cookie->setDi(dependencyInjector);
 
+			if this->_stateless {
+				cookie->{"setStateless"}(true);
+			}
+
 			let encryption = this->_useEncryption;
 
 			/**
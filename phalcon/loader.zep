@@ -73,6 +73,16 @@ class Loader implements EventsAwareInterface
 
 	protected fileCheckingCallback = "is_file";
 
+	protected _authoritative = false;
+
+	protected _cachePrefix = null;
+
+	protected _cacheHits = 0;
+
+	protected _cacheMisses = 0;
+
+	protected _fileChecks = 0;
+
 	/**
 	 * Sets the file check callback.
 	 *
@@ -103,6 +113,179 @@ class Loader implements EventsAwareInterface
 		return this;
 	}
 
+	/**
+	 * Sets whether the loader only loads the classes registered with
+	 * registerClasses(), usually a class map dumped by dumpClassMap(),
+	 * without looking for them in the namespaces and directories
+	 *
+	 * <code>
+	 * $loader->registerClasses(
+	 *     require "app/cache/classmap.php"
+	 * );
+	 *
+	 * $loader->setAuthoritative(true);
+	 * </code>
+	 */
+	public function setAuthoritative(boolean authoritative) -> <Loader>
+	{
+		let this->_authoritative = authoritative;
+		return this;
+	}
+
+	/**
+	 * Checks whether the loader only loads the registered classes
+	 */
+	public function isAuthoritative() -> boolean
+	{
+		return this->_authoritative;
+	}
+
+	/**
+	 * Sets the prefix of the APCu keys used to remember the file found, or not
+	 * found, for every class looked up in the namespaces and directories, so
+	 * they are not checked again in later requests. The prefix should change
+	 * every time the application is deployed. Passing NULL disables the cache
+	 *
+	 * <code>
+	 * $loader->setCachePrefix("loader-" . APP_VERSION . "-");
+	 * </code>
+	 */
+	public function setCachePrefix(string cachePrefix = null) -> <Loader>
+	{
+		if cachePrefix !== null && !function_exists("apcu_fetch") {
+			throw new Exception("The APCu extension is required to cache the lookups of the loader");
+		}
+
+		let this->_cachePrefix = cachePrefix;
+		return this;
+	}
+
+	/**
+	 * Returns the prefix of the APCu keys used to cache the lookups
+	 */
+	public function getCachePrefix() -> string | null
+	{
+		return this->_cachePrefix;
+	}
+
+	/**
+	 * Returns the number of lookups answered and not answered by the APCu cache
+	 * and the number of files checked
+	 */
+	public function getStats() -> array
+	{
+		return [
+			"hits":       this->_cacheHits,
+			"misses":     this->_cacheMisses,
+			"fileChecks": this->_fileChecks
+		];
+	}
+
+	/**
+	 * Scans the registered namespaces and directories and returns the path of
+	 * the file the loader would require for every class found, along with the
+	 * registered classes. If a path is passed the class map is also written
+	 * there as a PHP file returning it
+	 *
+	 * <code>
+	 * $loader->dumpClassMap("app/cache/classmap.php");
+	 * </code>
+	 */
+	public function dumpClassMap(string filePath = null) -> array
+	{
+		var classMap, extensions, ds, ns, nsPrefix, directories, directory, fixedDirectory,
+			files, position, fileName, className, temporaryPath;
+
+		let classMap = this->_classes,
+			extensions = this->_extensions,
+			ds = DIRECTORY_SEPARATOR,
+			ns = "\\";
+
+		for nsPrefix, directories in this->_namespaces {
+			for directory in directories {
+				let fixedDirectory = rtrim(directory, ds) . ds,
+					files = this->scanDirectory(fixedDirectory);
+
+				for fileName, position in files {
+					let className = nsPrefix . ns . str_replace(ds, ns, fileName);
+					if !isset classMap[className] {
+						let classMap[className] = fixedDirectory . fileName . "." . extensions[position];
+					}
+				}
+			}
+		}
+
+		for directory in this->_directories {
+			let fixedDirectory = rtrim(directory, ds) . ds,
+				files = this->scanDirectory(fixedDirectory);
+
+			for fileName, position in files {
+				let className = str_replace(ds, ns, fileName);
+				if !isset classMap[className] {
+					let classMap[className] = fixedDirectory . fileName . "." . extensions[position];
+				}
+			}
+		}
+
+		if filePath !== null {
+
+			/**
+			 * Write to a temporary file first so no request loads a half-written map
+			 */
+			let temporaryPath = filePath . "." . uniqid();
+
+			if file_put_contents(temporaryPath, "<?php\n\nreturn " . var_export(classMap, true) . ";\n") === false {
+				throw new Exception("Class map file " . filePath . " cannot be written");
+			}
+
+			if !rename(temporaryPath, filePath) {
+				unlink(temporaryPath);
+				throw new Exception("Class map file " . filePath . " cannot be written");
+			}
+		}
+
+		return classMap;
+	}
+
+	/**
+	 * Returns the files below a directory having one of the registered
+	 * extensions, indexed by their path without extension, with the position
+	 * of the extension the loader would try first
+	 */
+	protected function scanDirectory(string! directory) -> array
+	{
+		var files, extensions, item, extension, position, fileName, previous;
+
+		let files = [],
+			extensions = this->_extensions;
+
+		if !is_dir(directory) {
+			return files;
+		}
+
+		for item in iterator(new \RecursiveIteratorIterator(new \RecursiveDirectoryIterator(directory, \FilesystemIterator::SKIP_DOTS))) {
+
+			if !item->isFile() {
+				continue;
+			}
+
+			let extension = item->getExtension(),
+				position = array_search(extension, extensions, true);
+
+			if position === false {
+				continue;
+			}
+
+			let fileName = substr(item->getPathname(), strlen(directory), -(strlen(extension) + 1));
+
+			if !fetch previous, files[fileName] || position < previous {
+				let files[fileName] = position;
+			}
+		}
+
+		return files;
+	}
+
 	/**
 	 * Sets the events manager
 	 */
@@ -329,7 +512,8 @@ class Loader implements EventsAwareInterface
 	{
 		var eventsManager, classes, extensions, filePath, ds, fixedDirectory,
 			directories, ns, namespaces, nsPrefix,
-			directory, fileName, extension, nsClassName, fileCheckingCallback;
+			directory, fileName, extension, nsClassName, fileCheckingCallback,
+			cachePrefix, cacheKey;
 
 		let eventsManager = this->_eventsManager;
 		if typeof eventsManager == "object" {
@@ -349,6 +533,45 @@ class Loader implements EventsAwareInterface
 			return true;
 		}
 
+		/**
+		 * Only the registered classes are loaded in authoritative mode
+		 */
+		if this->_authoritative {
+			if typeof eventsManager == "object" {
+				eventsManager->fire("loader:afterCheckClass", this, className);
+			}
+			return false;
+		}
+
+		/**
+		 * Check if the lookup of the class was cached by a previous request
+		 */
+		let cachePrefix = this->_cachePrefix;
+		if cachePrefix !== null {
+			let cacheKey = cachePrefix . className,
+				filePath = apcu_fetch(cacheKey);
+
+			if typeof filePath == "string" {
+				let this->_cacheHits++;
+
+				if filePath === "" {
+					if typeof eventsManager == "object" {
+						eventsManager->fire("loader:afterCheckClass", this, className);
+					}
+					return false;
+				}
+
+				if typeof eventsManager == "object" {
+					let this->_foundPath = filePath;
+					eventsManager->fire("loader:pathFound", this, filePath);
+				}
+				require filePath;
+				return true;
+			}
+
+			let this->_cacheMisses++;
+		}
+
 		let extensions = this->_extensions;
 
 		let ds = DIRECTORY_SEPARATOR,
@@ -402,6 +625,7 @@ class Loader implements EventsAwareInterface
 					/**
 					 * This is probably a good path, let's check if the file exists
 					 */
+					let this->_fileChecks++;
 					if call_user_func(fileCheckingCallback, filePath) {
 
 						if typeof eventsManager == "object" {
@@ -409,6 +633,10 @@ class Loader implements EventsAwareInterface
 							eventsManager->fire("loader:pathFound", this, filePath);
 						}
 
+						if cachePrefix !== null {
+							apcu_store(cacheKey, filePath);
+						}
+
 						/**
 						 * Simulate a require
 						 */
@@ -455,6 +683,7 @@ class Loader implements EventsAwareInterface
 				/**
 				 * Check in every directory if the class exists here
 				 */
+				let this->_fileChecks++;
 				if call_user_func(fileCheckingCallback, filePath) {
 
 					/**
@@ -465,6 +694,10 @@ class Loader implements EventsAwareInterface
 						eventsManager->fire("loader:pathFound", this, filePath);
 					}
 
+					if cachePrefix !== null {
+						apcu_store(cacheKey, filePath);
+					}
+
 					/**
 					 * Simulate a require
 					 */
@@ -478,6 +711,13 @@ class Loader implements EventsAwareInterface
 			}
 		}
 
+		/**
+		 * Remember the class can't be found
+		 */
+		if cachePrefix !== null {
+			apcu_store(cacheKey, "");
+		}
+
 		/**
 		 * Call 'afterCheckClass' event
 		 */
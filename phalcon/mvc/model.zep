@@ -109,6 +109,8 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 
 	protected _related;
 
+	protected _eagerLoaded = [];
+
 	protected _snapshot;
 
 	protected _oldSnapshot;
@@ -555,78 +557,144 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	 */
 	public static function cloneResultMap(var base, array! data, var columnMap, int dirtyState = 0, boolean keepSnapshots = null) -> <Model>
 	{
-		var instance, attribute, key, value, castValue, attributeName;
+		return self::cloneResultMapPlan(
+			base,
+			data,
+			self::getHydrationPlan(data, columnMap),
+			columnMap,
+			dirtyState,
+			keepSnapshots
+		);
+	}
 
-		let instance = clone base;
+	/**
+	 * Builds the plan to hydrate rows having the same columns, so the column
+	 * map is resolved only once for all of them. Every step of the plan is
+	 * the column, the attribute to assign and how its value is cast
+	 * (0: as it is, 1: integer, 2: double, 3: boolean)
+	 *
+	 *<code>
+	 * $plan = \Phalcon\Mvc\Model::getHydrationPlan($row, $columnMap);
+	 *
+	 * foreach ($rows as $row) {
+	 *     $robot = \Phalcon\Mvc\Model::cloneResultMapPlan(
+	 *         $base,
+	 *         $row,
+	 *         $plan,
+	 *         $columnMap
+	 *     );
+	 * }
+	 *</code>
+	 *
+	 * @param array data
+	 * @param array columnMap
+	 */
+	public static function getHydrationPlan(array! data, var columnMap) -> array
+	{
+		var plan, key, attribute, cast;
 
-		// Change the dirty state to persistent
-		instance->setDirtyState(dirtyState);
+		let plan = [];
 
-		for key, value in data {
+		for key in array_keys(data) {
+
+			// Only string keys in the data are valid
+			if typeof key != "string" {
+				continue;
+			}
 
-			if typeof key == "string" {
+			if typeof columnMap != "array" {
+				let plan[] = [key, key, 0];
+				continue;
+			}
 
-				// Only string keys in the data are valid
-				if typeof columnMap != "array" {
-					let instance->{key} = value;
+			// Every field must be part of the column map
+			if !fetch attribute, columnMap[key] {
+				if !globals_get("orm.ignore_unknown_columns") {
+					throw new Exception("Column '" . key . "' doesn't make part of the column map");
+				} else {
 					continue;
 				}
+			}
 
-				// Every field must be part of the column map
-				if !fetch attribute, columnMap[key] {
-					if !globals_get("orm.ignore_unknown_columns") {
-						throw new Exception("Column '" . key . "' doesn't make part of the column map");
-					} else {
-						continue;
-					}
-				}
+			if typeof attribute != "array" {
+				let plan[] = [key, attribute, 0];
+				continue;
+			}
 
-				if typeof attribute != "array" {
-					let instance->{attribute} = value;
-					continue;
-				}
+			switch attribute[1] {
 
-				if value != "" && value !== null {
-					switch attribute[1] {
+				case Column::TYPE_INTEGER:
+					let cast = 1;
+					break;
 
-						case Column::TYPE_INTEGER:
-							let castValue = intval(value, 10);
-							break;
+				case Column::TYPE_DOUBLE:
+				case Column::TYPE_DECIMAL:
+				case Column::TYPE_FLOAT:
+					let cast = 2;
+					break;
 
-						case Column::TYPE_DOUBLE:
-						case Column::TYPE_DECIMAL:
-						case Column::TYPE_FLOAT:
-							let castValue = doubleval(value);
-							break;
+				case Column::TYPE_BOOLEAN:
+					let cast = 3;
+					break;
 
-						case Column::TYPE_BOOLEAN:
-							let castValue = (boolean) value;
-							break;
+				default:
+					let cast = 0;
+					break;
+			}
 
-						default:
-							let castValue = value;
+			let plan[] = [key, attribute[0], cast];
+		}
+
+		return plan;
+	}
+
+	/**
+	 * Assigns values to a model from an array following a plan built by
+	 * getHydrationPlan(), returning a new model
+	 *
+	 * @param \Phalcon\Mvc\ModelInterface|\Phalcon\Mvc\Model\Row base
+	 * @param array data
+	 * @param array plan
+	 * @param array columnMap
+	 * @param int dirtyState
+	 * @param boolean keepSnapshots
+	 */
+	public static function cloneResultMapPlan(var base, array! data, array! plan, var columnMap = null, int dirtyState = 0, boolean keepSnapshots = null) -> <Model>
+	{
+		var instance, step, value, attributeName;
+
+		let instance = clone base;
+
+		// Change the dirty state to persistent
+		instance->setDirtyState(dirtyState);
+
+		for step in plan {
+
+			let value = data[step[0]],
+				attributeName = step[1];
+
+			if step[2] {
+				if value != "" && value !== null {
+					switch step[2] {
+
+						case 1:
+							let value = intval(value, 10);
 							break;
-					}
-				} else {
-					switch attribute[1] {
-
-						case Column::TYPE_INTEGER:
-						case Column::TYPE_DOUBLE:
-						case Column::TYPE_DECIMAL:
-						case Column::TYPE_FLOAT:
-						case Column::TYPE_BOOLEAN:
-							let castValue = null;
+
+						case 2:
+							let value = doubleval(value);
 							break;
 
 						default:
-							let castValue = value;
+							let value = (boolean) value;
 							break;
 					}
+				} else {
+					let value = null;
 				}
-
-				let attributeName = attribute[0],
-					instance->{attributeName} = castValue;
 			}
+
+			let instance->{attributeName} = value;
 		}
 
 		/**
@@ -657,8 +725,6 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	 */
 	public static function cloneResultMapHydrate(array! data, var columnMap, int hydrationMode)
 	{
-		var hydrateArray, hydrateObject, key, value, attribute, attributeName;
-
 		/**
 		 * If there is no column map and the hydration mode is arrays return the data as it is
 		 */
@@ -668,58 +734,40 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 			}
 		}
 
+		return self::cloneResultMapHydratePlan(data, self::getHydrationPlan(data, columnMap), hydrationMode);
+	}
+
+	/**
+	 * Returns an hydrated result following a plan built by getHydrationPlan()
+	 *
+	 * @param array data
+	 * @param array plan
+	 * @param int hydrationMode
+	 * @return mixed
+	 */
+	public static function cloneResultMapHydratePlan(array! data, array! plan, int hydrationMode)
+	{
+		var hydrateArray, hydrateObject, step, attributeName;
+
 		/**
 		 * Create the destination object according to the hydration mode
 		 */
 		if hydrationMode == Resultset::HYDRATE_ARRAYS {
 			let hydrateArray = [];
-		} else {
-			let hydrateObject = new \stdclass();
-		}
 
-		for key, value in data {
-			if typeof key != "string" {
-				continue;
+			for step in plan {
+				let attributeName = step[1],
+					hydrateArray[attributeName] = data[step[0]];
 			}
 
-			if typeof columnMap == "array" {
-
-				/**
-				 * Every field must be part of the column map
-				 */
-				if !fetch attribute, columnMap[key] {
-					if !globals_get("orm.ignore_unknown_columns") {
-						throw new Exception("Column '" . key . "' doesn't make part of the column map");
-					} else {
-						continue;
-					}
-				}
-
-				/**
-				 * Attribute can store info about his type
-				 */
-				if (typeof attribute == "array") {
-					let attributeName = attribute[0];
-				} else {
-					let attributeName = attribute;
-				}
-
-				if hydrationMode == Resultset::HYDRATE_ARRAYS {
-					let hydrateArray[attributeName] = value;
-				} else {
-					let hydrateObject->{attributeName} = value;
-				}
-			} else {
-				if hydrationMode == Resultset::HYDRATE_ARRAYS {
-					let hydrateArray[key] = value;
-				} else {
-					let hydrateObject->{key} = value;
-				}
-			}
+			return hydrateArray;
 		}
 
-		if hydrationMode == Resultset::HYDRATE_ARRAYS {
-			return hydrateArray;
+		let hydrateObject = new \stdclass();
+
+		for step in plan {
+			let attributeName = step[1],
+				hydrateObject->{attributeName} = data[step[0]];
 		}
 
 		return hydrateObject;
@@ -976,7 +1024,8 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	 * shared prepare query logic for find and findFirst method
 	 */
 	private static function getPreparedQuery(var params, var limit = null) -> <Query> {
-		var builder, bindParams, bindTypes, transaction, cache, manager, query, dependencyInjector;
+		var builder, bindParams, bindTypes, transaction, cache, manager, query, dependencyInjector,
+			streaming;
 
 		let dependencyInjector = Di::getDefault();
 		let manager = <ManagerInterface> dependencyInjector->getShared("modelsManager");
@@ -1021,6 +1070,13 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 			query->cache(cache);
 		}
 
+		/**
+		 * Return a forward-only resultset fetching one row at a time
+		 */
+		if fetch streaming, params["stream"] {
+			query->setStreaming(streaming);
+		}
+
 		return query;
 	}
 	/**
@@ -3237,6 +3293,197 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		return this->save(data, whiteList);
 	}
 
+	/**
+	 * Inserts many records using multi-row INSERT statements of chunkSize
+	 * rows, every row is an array with the same attributes (column map
+	 * names when renaming is enabled), the columns are taken from the first
+	 * row. Validation and events are skipped unless fireEvents is true
+	 *
+	 * With fireEvents a record is created for every row and goes through
+	 * the same chain as save() for a new record: "prepareSave",
+	 * "beforeValidation", "beforeValidationOnCreate", the automatic not null
+	 * validation, "validation", "afterValidationOnCreate", "afterValidation",
+	 * "beforeSave" and "beforeCreate". Records cancelled by any of them are
+	 * not inserted. Once every chunk is inserted "afterCreate" and
+	 * "afterSave" are fired for the inserted records
+	 *
+	 * The identities generated for the inserted rows are returned in the
+	 * same order, false is returned if any chunk fails and true if the model
+	 * has no identity column or the rows set it explicitly. With fireEvents
+	 * the identities are assigned to the records before "afterCreate" and
+	 * "afterSave" are fired. Attributes changed by the events are only
+	 * inserted if they are columns of the first row
+	 *
+	 * PostgreSQL reads the identities with a RETURNING clause. MySQL and
+	 * SQLite compute them from the last insert id, on MySQL this requires
+	 * the auto-increment lock mode (innodb_autoinc_lock_mode) to be 0 or 1
+	 *
+	 *<code>
+	 * Robots::batchCreate(
+	 *     [
+	 *         [
+	 *             "name" => "Astro Boy",
+	 *             "year" => 1952,
+	 *         ],
+	 *         [
+	 *             "name" => "Robotina",
+	 *             "year" => 1972,
+	 *         ],
+	 *     ]
+	 * );
+	 *
+	 * // The generated ids, e.g. [11, 12]
+	 * $ids = Robots::batchCreate($rows);
+	 *</code>
+	 */
+	public static function batchCreate(array! rows, boolean fireEvents = false, int chunkSize = 500) -> array | boolean
+	{
+		var modelName, model, metaData, reverseColumnMap, bindTypes, attributes,
+			attribute, field, fields, dataTypes, values, rowValues, records, record,
+			row, value, schema, source, table, connection, bindType, identityField,
+			ids, position, columnMap, identityAttribute;
+
+		if !count(rows) {
+			return [];
+		}
+
+		let modelName = get_called_class(),
+			model = new {modelName}(),
+			metaData = model->getModelsMetaData(),
+			bindTypes = metaData->getBindTypes(model);
+
+		if globals_get("orm.column_renaming") {
+			let reverseColumnMap = metaData->getReverseColumnMap(model);
+		} else {
+			let reverseColumnMap = null;
+		}
+
+		/**
+		 * The columns are taken from the first row
+		 */
+		let row = array_values(rows),
+			attributes = array_keys(row[0]),
+			fields = [],
+			dataTypes = [];
+
+		for attribute in attributes {
+			if typeof reverseColumnMap == "array" {
+				if !fetch field, reverseColumnMap[attribute] {
+					throw new Exception("Column '" . attribute . "' isn't part of the column map");
+				}
+			} else {
+				let field = attribute;
+			}
+
+			if !fetch bindType, bindTypes[field] {
+				throw new Exception("Column '" . field . "' have not defined a bind data type in '" . modelName . "'");
+			}
+
+			let fields[] = field,
+				dataTypes[] = bindType;
+		}
+
+		let values = [],
+			records = [],
+			identityField = metaData->getIdentityField(model);
+
+		for row in rows {
+
+			if fireEvents {
+				let record = clone model;
+				record->assign(row);
+
+				record->fireEvent("prepareSave");
+
+				/**
+				 * Same validations and events as save() for a new record
+				 */
+				if record->_preSave(metaData, false, identityField) === false {
+					if globals_get("orm.exception_on_failed_save") {
+						throw new ValidationFailed(record, record->getMessages());
+					}
+					continue;
+				}
+
+				let records[] = record,
+					rowValues = [];
+
+				for attribute in attributes {
+					let rowValues[] = record->readAttribute(attribute);
+				}
+			} else {
+				let rowValues = [];
+
+				for attribute in attributes {
+					if !fetch value, row[attribute] {
+						let value = null;
+					}
+					let rowValues[] = value;
+				}
+			}
+
+			let values[] = rowValues;
+		}
+
+		if !count(values) {
+			return [];
+		}
+
+		let schema = model->getSchema(),
+			source = model->getSource();
+
+		if schema {
+			let table = [schema, source];
+		} else {
+			let table = source;
+		}
+
+		let connection = model->getWriteConnection();
+
+		/**
+		 * The identities are only generated if the rows don't set them
+		 */
+		if !identityField || in_array(identityField, fields) {
+			if !connection->{"insertMultiple"}(table, values, fields, dataTypes, chunkSize) {
+				return false;
+			}
+
+			let ids = true;
+		} else {
+			let ids = connection->{"insertMultipleReturningIds"}(table, values, fields, dataTypes, identityField, chunkSize);
+			if typeof ids != "array" {
+				return false;
+			}
+
+			if globals_get("orm.column_renaming") {
+				let columnMap = metaData->getColumnMap(model);
+			} else {
+				let columnMap = null;
+			}
+
+			if typeof columnMap == "array" {
+				let identityAttribute = columnMap[identityField];
+			} else {
+				let identityAttribute = identityField;
+			}
+		}
+
+		for position, record in records {
+			if typeof ids == "array" {
+				record->writeAttribute(identityAttribute, ids[position]);
+			}
+
+			record->setDirtyState(self::DIRTY_STATE_PERSISTENT);
+
+			if globals_get("orm.events") {
+				record->_postSave(true, false);
+			}
+			record->fireEvent("afterSave");
+		}
+
+		return ids;
+	}
+
 	/**
 	 * Updates a model instance. If the instance doesn't exist in the persistence it will throw an exception
 	 * Returning true on success or false otherwise.
@@ -4219,7 +4466,14 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	 */
 	public function getRelated(string alias, arguments = null) -> <ResultsetInterface>
 	{
-		var relation, className, manager;
+		var relation, className, manager, related;
+
+		/**
+		 * Return the records assigned by the eager loading if any
+		 */
+		if arguments === null && fetch related, this->_eagerLoaded[strtolower(alias)] {
+			return related;
+		}
 
 		/**
 		 * Query the relation by alias
@@ -4237,6 +4491,18 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		return manager->getRelationRecords(relation, null, this, arguments);
 	}
 
+	/**
+	 * Assigns the records of a relation loaded by Phalcon\Mvc\Model\Manager::eagerLoad(),
+	 * they are returned instead of querying the relation again
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function setEagerLoaded(string! alias, var related) -> <Model>
+	{
+		let this->_eagerLoaded[strtolower(alias)] = related;
+		return this;
+	}
+
 	/**
 	 * Returns related records defined relations depending on the method name
 	 *
@@ -4247,7 +4513,7 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	 */
 	protected function _getRelatedRecords(string! modelName, string! method, var arguments)
 	{
-		var manager, relation, queryMethod, extraArgs;
+		var manager, relation, queryMethod, extraArgs, related;
 
 		let manager = <ManagerInterface> this->_modelsManager;
 
@@ -4278,6 +4544,13 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 
 		fetch extraArgs, arguments[0];
 
+		/**
+		 * Return the records assigned by the eager loading if any
+		 */
+		if queryMethod === null && extraArgs === null && fetch related, this->_eagerLoaded[strtolower(substr(method, 3))] {
+			return related;
+		}
+
 		return manager->getRelationRecords(
 			relation,
 			queryMethod,
@@ -4566,6 +4839,14 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 			if isset this->{lowerProperty} && typeof this->{lowerProperty} == "object" {
 				return this->{lowerProperty};
 			}
+
+			/**
+			 * Return the records assigned by the eager loading if any
+			 */
+			if fetch result, this->_eagerLoaded[lowerProperty] {
+				return result;
+			}
+
 			/**
 			 * Get the related records
 			 */
@@ -4800,7 +5081,8 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		var disableEvents, columnRenaming, notNullValidations,
 			exceptionOnFailedSave, phqlLiterals, virtualForeignKeys,
 			lateStateBinding, castOnHydrate, ignoreUnknownColumns,
-			updateSnapshotOnSave, disableAssignSetters;
+			updateSnapshotOnSave, disableAssignSetters, persistentPhqlCache,
+			persistentPhqlCacheSize, metaDataVersion;
 
 		/**
 		 * Enables/Disables globally the internal events
@@ -4872,6 +5154,28 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		if fetch disableAssignSetters, options["disableAssignSetters"] {
 		    globals_set("orm.disable_assign_setters", disableAssignSetters);
 		}
+
+		/**
+		 * Enables/Disables the cross-request cache of prepared PHQL statements
+		 */
+		if fetch persistentPhqlCache, options["persistentPhqlCache"] {
+			globals_set("orm.persistent_phql_cache", persistentPhqlCache);
+		}
+
+		/**
+		 * Maximum number of PHQL statements stored in the cross-request cache
+		 */
+		if fetch persistentPhqlCacheSize, options["persistentPhqlCacheSize"] {
+			globals_set("orm.persistent_phql_cache_size", persistentPhqlCacheSize);
+		}
+
+		/**
+		 * Version of the models metadata, changing it invalidates the prepared
+		 * PHQL statements stored in the cross-request cache
+		 */
+		if fetch metaDataVersion, options["metaDataVersion"] {
+			globals_set("orm.metadata_version", metaDataVersion);
+		}
 	}
 
 	/**
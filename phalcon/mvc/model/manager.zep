@@ -26,6 +26,7 @@ use Phalcon\Mvc\Model\Exception;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Db\AdapterInterface;
 use Phalcon\Mvc\Model\ResultsetInterface;
+use Phalcon\Mvc\Model\Resultset\Simple;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Events\EventsAwareInterface;
@@ -1418,6 +1419,320 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 		return records;
 	}
 
+	/**
+	 * Loads the relations of one or many records issuing one query per
+	 * relation instead of one query per record. Nested relations are
+	 * separated by dots and every relation could have its own parameters
+	 *
+	 *<code>
+	 * $robots = Robots::find();
+	 *
+	 * $modelsManager->eagerLoad(
+	 *     iterator_to_array($robots),
+	 *     [
+	 *         "robotsParts" => [
+	 *             "order" => "id DESC",
+	 *         ],
+	 *         "robotsParts.parts",
+	 *     ]
+	 * );
+	 *</code>
+	 *
+	 * @param \Phalcon\Mvc\ModelInterface|\Phalcon\Mvc\ModelInterface[] records
+	 */
+	public function eagerLoad(var records, var relations) -> void
+	{
+		var parents, record, eagerLoads;
+
+		if typeof records == "object" {
+			if records instanceof ModelInterface {
+				let parents = [records];
+			} else {
+				let parents = iterator_to_array(records, false);
+			}
+		} elseif typeof records == "array" {
+			let parents = records;
+		} else {
+			return;
+		}
+
+		for record in parents {
+			let eagerLoads = this->getEagerLoads(get_class(record), parents, relations);
+			break;
+		}
+
+		if typeof eagerLoads != "array" || !count(eagerLoads) {
+			return;
+		}
+
+		for record in parents {
+			this->assignEagerLoads(record, eagerLoads);
+		}
+	}
+
+	/**
+	 * Queries the relations of a list of records or rows of the given model.
+	 * The result must be assigned to every record with assignEagerLoads()
+	 */
+	public function getEagerLoads(string! modelName, array! parents, var relations) -> array
+	{
+		var eagerLoads, alias, options;
+
+		let eagerLoads = [];
+
+		for alias, options in this->_getEagerLoadTree(relations) {
+			let eagerLoads[] = this->_getEagerLoad(modelName, alias, parents, options);
+		}
+
+		return eagerLoads;
+	}
+
+	/**
+	 * Assigns the records returned by getEagerLoads() to a record. To-many
+	 * relations are assigned as resultsets and to-one relations as a record
+	 * or false, the same values returned when the relations are lazy loaded
+	 */
+	public function assignEagerLoads(<ModelInterface> record, array! eagerLoads) -> void
+	{
+		var eagerLoad, key, rows, resultset, related;
+
+		for eagerLoad in eagerLoads {
+			let key = record->readAttribute(eagerLoad["field"]),
+				rows = eagerLoad["rows"];
+
+			if key === null || !fetch related, rows[key] {
+				let related = [];
+			} elseif !eagerLoad["many"] {
+				let related = [related];
+			}
+
+			/**
+			 * Every record gets its own resultset hydrated like the eager query
+			 */
+			let resultset = clone eagerLoad["resultset"];
+			resultset->assignRows(related, eagerLoad["with"]);
+
+			if eagerLoad["many"] {
+				let related = resultset;
+			} else {
+				let related = resultset->getFirst();
+			}
+
+			if record instanceof \Phalcon\Mvc\Model {
+				record->setEagerLoaded(eagerLoad["alias"], related);
+			} else {
+				record->writeAttribute(eagerLoad["alias"], related);
+			}
+		}
+	}
+
+	/**
+	 * Converts the relations passed to eagerLoad() into a tree of relation
+	 * aliases with their parameters and nested relations
+	 */
+	protected final function _getEagerLoadTree(var relations) -> array
+	{
+		var tree, path, parameters, aliases, alias, nested, options;
+
+		if typeof relations == "string" {
+			let relations = [relations];
+		}
+
+		if typeof relations != "array" {
+			throw new Exception("Relations to eager load must be a string or an array");
+		}
+
+		let tree = [];
+
+		for path, parameters in relations {
+
+			if typeof path == "integer" {
+				let path = parameters,
+					parameters = null;
+			}
+
+			if typeof parameters == "string" {
+				let parameters = [parameters];
+			}
+
+			let aliases = explode(".", strtolower(path), 2),
+				alias = aliases[0];
+
+			if !fetch options, tree[alias] {
+				let options = [
+					"parameters": null,
+					"with":       []
+				];
+			}
+
+			if fetch nested, aliases[1] {
+				let options["with"][nested] = parameters;
+			} else {
+				let options["parameters"] = parameters;
+			}
+
+			let tree[alias] = options;
+		}
+
+		return tree;
+	}
+
+	/**
+	 * Queries a relation of a list of records or rows, indexing the rows of
+	 * the related records by the value of the relation field. The rows are
+	 * hydrated by assignEagerLoads()
+	 */
+	protected final function _getEagerLoad(string! modelName, string! alias, array! parents, array! options) -> array
+	{
+		var relation, fields, referencedFields, referencedModel, intermediateModel,
+			intermediateFields, intermediateReferencedFields, parent, value,
+			keys, builder, records, key, rows, row, referencedKeys, parentKeys,
+			parentKey, related, nested, resultset, renamedRows, index, eagerLoads;
+		boolean many;
+
+		let relation = <RelationInterface> this->getRelationByAlias(modelName, alias);
+		if typeof relation != "object" {
+			throw new Exception("There is no defined relations for the model '" . modelName . "' using alias '" . alias . "'");
+		}
+
+		let fields = relation->getFields();
+		if typeof fields == "array" {
+			throw new Exception("Eager loading of relations with compound keys is not supported");
+		}
+
+		if relation->isThrough() {
+			let many = relation->getType() == Relation::HAS_MANY_THROUGH;
+		} else {
+			let many = relation->getType() == Relation::HAS_MANY;
+		}
+
+		let referencedModel = relation->getReferencedModel(),
+			referencedFields = relation->getReferencedFields();
+
+		/**
+		 * Collect the distinct values of the relation field
+		 */
+		let keys = [];
+		for parent in parents {
+			if typeof parent == "array" {
+				if !fetch value, parent[fields] {
+					continue;
+				}
+			} else {
+				let value = parent->readAttribute(fields);
+			}
+
+			if typeof value == "integer" || typeof value == "string" {
+				let keys[value] = value;
+			}
+		}
+
+		let records = [],
+			referencedKeys = null,
+			resultset = null;
+
+		if count(keys) {
+
+			let builder = this->createBuilder(this->_mergeFindParameters(relation->getParams(), options["parameters"]));
+			builder->from(referencedModel);
+
+			if relation->isThrough() {
+
+				let intermediateModel = relation->getIntermediateModel(),
+					intermediateFields = relation->getIntermediateFields(),
+					intermediateReferencedFields = relation->getIntermediateReferencedFields();
+
+				/**
+				 * Read the pairs of keys stored in the intermediate model
+				 */
+				let rows = this->createBuilder()
+					->columns("[" . intermediateModel . "].[" . intermediateFields . "] AS parentKey, [" . intermediateModel . "].[" . intermediateReferencedFields . "] AS referencedKey")
+					->from(intermediateModel)
+					->inWhere("[" . intermediateModel . "].[" . intermediateFields . "]", array_values(keys))
+					->getQuery()
+					->execute();
+
+				let referencedKeys = [];
+				for row in rows->toArray() {
+					if !fetch parentKeys, referencedKeys[row["referencedKey"]] {
+						let parentKeys = [];
+					}
+
+					let parentKeys[] = row["parentKey"],
+						referencedKeys[row["referencedKey"]] = parentKeys;
+				}
+
+				if count(referencedKeys) {
+					builder->inWhere("[" . referencedModel . "].[" . referencedFields . "]", array_keys(referencedKeys));
+					let resultset = builder->getQuery()->execute();
+				}
+			} else {
+				builder->inWhere("[" . referencedModel . "].[" . referencedFields . "]", array_values(keys));
+				let resultset = builder->getQuery()->execute();
+			}
+		}
+
+		let eagerLoads = [];
+
+		if typeof resultset == "object" {
+
+			if !(resultset instanceof Simple) {
+				throw new Exception("Relations can only be eager loaded with queries returning complete records");
+			}
+
+			/**
+			 * The raw rows are kept to hydrate the records, the renamed rows
+			 * give the values of the attributes
+			 */
+			let rows = resultset->toArray(false),
+				renamedRows = resultset->toArray();
+
+			for index, row in renamedRows {
+				let key = row[referencedFields];
+
+				if typeof referencedKeys == "array" {
+					if !fetch parentKeys, referencedKeys[key] {
+						continue;
+					}
+				} else {
+					let parentKeys = [key];
+				}
+
+				for parentKey in parentKeys {
+					if many {
+						if !fetch related, records[parentKey] {
+							let related = [];
+						}
+
+						let related[] = rows[index],
+							records[parentKey] = related;
+					} elseif !isset records[parentKey] {
+						let records[parentKey] = rows[index];
+					}
+				}
+			}
+
+			/**
+			 * Nested relations are loaded from all the related rows at once
+			 */
+			let nested = options["with"];
+			if count(nested) && count(renamedRows) {
+				let eagerLoads = this->getEagerLoads(referencedModel, renamedRows, nested);
+			}
+		} else {
+			let resultset = new Simple(null, this->load(referencedModel), false);
+		}
+
+		return [
+			"alias":     alias,
+			"field":     fields,
+			"many":      many,
+			"rows":      records,
+			"resultset": resultset,
+			"with":      eagerLoads
+		];
+	}
+
 	/**
 	 * Returns a reusable object from the internal list
 	 */
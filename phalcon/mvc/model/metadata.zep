@@ -225,6 +225,109 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
 		return this->_strategy;
 	}
 
+	/**
+	 * Loads the meta-data of many models at once. When it's obtained by
+	 * introspection, the tables of each connection and schema are described
+	 * with a single query instead of two queries per model
+	 *
+	 *<code>
+	 * $metaData->warmUp(
+	 *     [
+	 *         Robots::class,
+	 *         RobotsParts::class,
+	 *     ]
+	 * );
+	 *</code>
+	 *
+	 * @param array models Class names or instances of the models
+	 */
+	public function warmUp(array! models) -> void
+	{
+		var strategy, item, model, schema, source, key, data, connection,
+			groupKey, groups, group, tables, columns, completeTable;
+
+		let strategy = this->getStrategy(),
+			groups = [];
+
+		for item in models {
+			if typeof item == "string" {
+				let model = new {item}();
+			} else {
+				let model = item;
+			}
+
+			if typeof model != "object" || !(model instanceof ModelInterface) {
+				throw new Exception("Only models can be warmed up");
+			}
+
+			/**
+			 * Column maps don't need the database
+			 */
+			this->readColumnMap(model);
+
+			if !(strategy instanceof Introspection) || method_exists(model, "metaData") {
+				this->readMetaData(model);
+				continue;
+			}
+
+			let schema = model->getSchema(),
+				source = model->getSource(),
+				key = get_class_lower(model) . "-" . schema . source;
+
+			if isset this->_metaData[key] {
+				continue;
+			}
+
+			let data = this->{"read"}("meta-" . key);
+			if data !== null {
+				let this->_metaData[key] = data;
+				continue;
+			}
+
+			/**
+			 * Models are grouped by connection and schema
+			 */
+			let connection = model->getReadConnection(),
+				groupKey = spl_object_hash(connection) . "-" . schema;
+
+			if !isset groups[groupKey] {
+				let groups[groupKey] = [connection, schema, []];
+			}
+
+			let groups[groupKey][2][key] = model;
+		}
+
+		for group in groups {
+
+			let connection = group[0],
+				schema = group[1],
+				tables = connection->{"describeSchemaColumns"}(schema);
+
+			for key, model in group[2] {
+
+				let source = model->getSource();
+
+				if !fetch columns, tables[source] {
+
+					if schema {
+						let completeTable = schema . "'.'" . source;
+					} else {
+						let completeTable = source;
+					}
+
+					throw new Exception(
+						"Table '" . completeTable . "' doesn't exist in database when dumping meta-data for " . get_class(model)
+					);
+				}
+
+				let data = strategy->{"getMetaDataFromColumns"}(columns),
+					this->_metaData[key] = data;
+
+				this->{"write"}("meta-" . key, data);
+			}
+		}
+	}
+
 	/**
 	 * Reads the complete meta-data for certain model
 	 *
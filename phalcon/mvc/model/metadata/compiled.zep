@@ -0,0 +1,196 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file LICENSE.txt.                             |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Mvc\Model\MetaData;
+
+use Phalcon\Mvc\ModelInterface;
+use Phalcon\Mvc\Model\MetaData;
+use Phalcon\Mvc\Model\Exception;
+
+/**
+ * Phalcon\Mvc\Model\MetaData\Compiled
+ *
+ * Stores the meta-data of all the models in a single PHP file generated when
+ * deploying the application, models not found in it fall back to the
+ * meta-data strategy without writing anything.
+ *
+ * The file is loaded once per request. It returns a constant array so with
+ * opcache it's served from shared memory without being parsed again, set
+ * opcache.validate_timestamps=0 and opcache.enable_file_override=1 in
+ * production to avoid checking the file on every request too.
+ *
+ *<code>
+ * $metaData = new \Phalcon\Mvc\Model\MetaData\Compiled(
+ *     [
+ *         "metaDataFile" => "app/cache/metadata.php",
+ *     ]
+ * );
+ *
+ * // Regenerates the file from the current strategy
+ * $metaData->compile(
+ *     [
+ *         Robots::class,
+ *         RobotsParts::class,
+ *     ]
+ * );
+ *</code>
+ */
+class Compiled extends MetaData
+{
+
+	protected _metaData = [];
+
+	protected _metaDataFile = "./metadata.php";
+
+	protected _data;
+
+	protected static _files = [];
+
+	/**
+	 * Phalcon\Mvc\Model\MetaData\Compiled constructor
+	 *
+	 * @param array options
+	 */
+	public function __construct(options = null)
+	{
+		var metaDataFile;
+
+		if typeof options == "array" {
+			if fetch metaDataFile, options["metaDataFile"] {
+				let this->_metaDataFile = metaDataFile;
+			}
+		}
+	}
+
+	/**
+	 * Reads the meta-data from the compiled file
+	 *
+	 * @param string key
+	 * @return mixed
+	 */
+	public function read(string! key)
+	{
+		var data;
+
+		if typeof this->_data != "array" {
+			let this->_data = self::load(this->_metaDataFile);
+		}
+
+		if fetch data, this->_data[key] {
+			return data;
+		}
+
+		return null;
+	}
+
+	/**
+	 * Keeps the meta-data in memory, the compiled file is only written by
+	 * compile()
+	 *
+	 * @param string key
+	 * @param array data
+	 */
+	public function write(string! key, var data) -> void
+	{
+		if typeof this->_data != "array" {
+			let this->_data = self::load(this->_metaDataFile);
+		}
+
+		let this->_data[key] = data;
+	}
+
+	/**
+	 * Generates the compiled file with the meta-data of the given models
+	 * using the meta-data strategy and returns it
+	 *
+	 * @param array models Class names or instances of the models
+	 */
+	public function compile(array! models) -> array
+	{
+		var metaDataFile, item, model, data, tmpFile;
+
+		let this->_data = [];
+		this->reset();
+
+		for item in models {
+			if typeof item == "string" {
+				let model = new {item}();
+			} else {
+				let model = item;
+			}
+
+			if typeof model != "object" || !(model instanceof ModelInterface) {
+				throw new Exception("Only models can be compiled");
+			}
+
+			this->readMetaData(model);
+			this->readColumnMap(model);
+		}
+
+		let data = this->_data,
+			metaDataFile = this->_metaDataFile;
+
+		/**
+		 * The file is replaced atomically so concurrent requests never load
+		 * a partial file
+		 */
+		let tmpFile = metaDataFile . "." . uniqid("", true) . ".tmp";
+
+		if file_put_contents(tmpFile, "<?php return " . var_export(data, true) . ";") === false {
+			throw new Exception("Meta-Data file cannot be written");
+		}
+
+		if !rename(tmpFile, metaDataFile) {
+			unlink(tmpFile);
+			throw new Exception("Meta-Data file cannot be written");
+		}
+
+		if function_exists("opcache_invalidate") {
+			opcache_invalidate(metaDataFile, true);
+		}
+
+		let self::_files[metaDataFile] = data;
+
+		return data;
+	}
+
+	/**
+	 * Loads a compiled file once per request
+	 */
+	protected static function load(string! metaDataFile) -> array
+	{
+		var data = null;
+
+		if fetch data, self::_files[metaDataFile] {
+			return data;
+		}
+
+		if file_exists(metaDataFile) {
+			let data = require metaDataFile;
+		}
+
+		if typeof data != "array" {
+			let data = [];
+		}
+
+		let self::_files[metaDataFile] = data;
+
+		return data;
+	}
+}
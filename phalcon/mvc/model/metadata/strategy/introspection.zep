@@ -39,10 +39,7 @@ class Introspection implements StrategyInterface
 	 */
 	public final function getMetaData(<ModelInterface> model, <DiInterface> dependencyInjector) -> array
 	{
-		var schema, table, readConnection, columns, attributes,
-			primaryKeys, nonPrimaryKeys, completeTable, numericTyped, notNull,
-			fieldTypes, automaticDefault, identityField, fieldBindTypes,
-			defaultValues, column, fieldName, defaultValue, emptyStringValues;
+		var schema, table, readConnection, columns, completeTable;
 
 		let schema    = model->getSchema(),
 			table     = model->getSource();
@@ -88,6 +85,20 @@ class Introspection implements StrategyInterface
 			);
 		}
 
+		return this->getMetaDataFromColumns(columns);
+	}
+
+	/**
+	 * Creates the meta-data from the column descriptions of a table
+	 *
+	 * @param \Phalcon\Db\ColumnInterface[] columns
+	 */
+	public final function getMetaDataFromColumns(array! columns) -> array
+	{
+		var attributes, primaryKeys, nonPrimaryKeys, numericTyped, notNull,
+			fieldTypes, automaticDefault, identityField, fieldBindTypes,
+			defaultValues, column, fieldName, defaultValue, emptyStringValues;
+
 		/**
 		 * Initialize meta-data
 		 */
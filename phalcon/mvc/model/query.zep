@@ -145,8 +145,28 @@ class Query implements QueryInterface, InjectionAwareInterface
 	 */
 	protected _transaction { get };
 
+	/**
+	 * Relations eager loaded on the records returned by a SELECT
+	 */
+	protected _with;
+
+	/**
+	 * Whether SELECTs return forward-only streaming resultsets
+	 */
+	protected _streaming = false;
+
 	static protected _irPhqlCache;
 
+	/**
+	 * Identifies the IR in the SQL cache, when it is known
+	 */
+	protected _irId;
+
+	/**
+	 * SQL rendered by the dialects for every IR, dialect and bind shape
+	 */
+	static protected _sqlCache;
+
 	const TYPE_SELECT = 309;
 
 	const TYPE_INSERT = 306;
@@ -155,6 +175,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 
 	const TYPE_DELETE = 303;
 
+	const SQL_CACHE_SIZE = 1024;
+
 	/**
 	 * Phalcon\Mvc\Model\Query constructor
 	 *
@@ -2466,18 +2488,44 @@ class Query implements QueryInterface, InjectionAwareInterface
 	 */
 	public function parse() -> array
 	{
-		var intermediate, phql, ast, irPhql, uniqueId, type;
+		var intermediate, phql, ast, irPhql, uniqueId, type, persistentKey,
+			persistent;
 
 		let intermediate = this->_intermediate;
 		if typeof intermediate == "array" {
 			return intermediate;
 		}
 
+		let phql = this->_phql,
+			persistentKey = null;
+
 		/**
-		 * This function parses the PHQL statement
+		 * Check if the prepared PHQL is stored in the cross-request cache,
+		 * in that case the statement is neither parsed nor prepared again
 		 */
-		let phql = this->_phql,
-			ast = phql_parse_phql(phql);
+		if globals_get("orm.persistent_phql_cache") {
+			let persistentKey = self::getPersistentCacheKey(phql);
+
+			if !fetch persistent, self::_irPhqlCache[persistentKey] {
+				let persistent = self::fetchPersistentCache(persistentKey);
+			}
+
+			if typeof persistent == "array" {
+				let self::_irPhqlCache[persistentKey] = persistent,
+					this->_type = persistent["type"],
+					this->_irId = persistentKey;
+
+				return persistent["intermediate"];
+			}
+		}
+
+		/**
+		 * This function parses the PHQL statement unless its AST was assigned
+		 */
+		let ast = this->_ast;
+		if typeof ast != "array" {
+			let ast = phql_parse_phql(phql);
+		}
 
 		let irPhql = null, uniqueId = null;
 
@@ -2491,7 +2539,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 				if fetch irPhql, self::_irPhqlCache[uniqueId] {
 					if typeof irPhql == "array" {
 						// Assign the type to the query
-						let this->_type = ast["type"];
+						let this->_type = ast["type"],
+							this->_irId = uniqueId;
 						return irPhql;
 					}
 				}
@@ -2536,8 +2585,22 @@ class Query implements QueryInterface, InjectionAwareInterface
 		/**
 		 * Store the prepared AST in the cache
 		 */
-		if typeof uniqueId == "int" {
-			let self::_irPhqlCache[uniqueId] = irPhql;
+		if typeof uniqueId == "int" || typeof uniqueId == "string" {
+			let self::_irPhqlCache[uniqueId] = irPhql,
+				this->_irId = uniqueId;
+		}
+
+		if persistentKey !== null {
+			let persistent = [
+				"type":         this->_type,
+				"intermediate": irPhql
+			];
+
+			let self::_irPhqlCache[persistentKey] = persistent;
+
+			self::storePersistentCache(persistentKey, persistent);
+
+			let this->_irId = persistentKey;
 		}
 
 		let this->_intermediate = irPhql;
@@ -2563,7 +2626,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 			sqlColumn, attributes, instance, columnMap, attribute,
 			columnAlias, sqlAlias, dialect, sqlSelect, bindCounts,
 			processed, wildcard, value, processedTypes, typeWildcard, result,
-			resultData, cache, resultObject, columns1, typesColumnMap, wildcardValue, resultsetClassName;
+			resultData, cache, resultObject, columns1, typesColumnMap, wildcardValue, resultsetClassName,
+			bindShape, sqlCacheKey = null;
 		boolean haveObjects, haveScalars, isComplex, isSimpleStd, isKeepingSnapshots;
 		int numberObjects;
 
@@ -2721,6 +2785,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 		}
 
 		let bindCounts = [],
+			bindShape = "",
 			intermediate["columns"] = selectColumns;
 
 		/**
@@ -2738,7 +2803,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 
 				let processed[wildcardValue] = value;
 				if typeof value == "array" {
-					let bindCounts[wildcardValue] = count(value);
+					let bindCounts[wildcardValue] = count(value),
+						bindShape .= wildcardValue . ":" . bindCounts[wildcardValue] . ",";
 				}
 			}
 		} else {
@@ -2765,13 +2831,34 @@ class Query implements QueryInterface, InjectionAwareInterface
 			let intermediate["bindCounts"] = bindCounts;
 		}
 
+		let dialect = connection->getDialect(),
+			sqlSelect = null;
+
 		/**
-		 * The corresponding SQL dialect generates the SQL statement based accordingly with the database system
+		 * The SQL only depends on the IR, the dialect and the number of values of the array placeholders
 		 */
-		let dialect = connection->getDialect(),
-			sqlSelect = dialect->select(intermediate);
-		if this->_sharedLock {
-			let sqlSelect = dialect->sharedLock(sqlSelect);
+		if this->_irId !== null {
+			let sqlCacheKey = this->_irId . "|" . get_class(dialect) . "|" . bindShape;
+			if this->_sharedLock {
+				let sqlCacheKey .= "|shared";
+			}
+
+			fetch sqlSelect, self::_sqlCache[sqlCacheKey];
+		}
+
+		if typeof sqlSelect != "string" {
+
+			/**
+			 * The corresponding SQL dialect generates the SQL statement based accordingly with the database system
+			 */
+			let sqlSelect = dialect->select(intermediate);
+			if this->_sharedLock {
+				let sqlSelect = dialect->sharedLock(sqlSelect);
+			}
+
+			if sqlCacheKey !== null && count(self::_sqlCache) < self::SQL_CACHE_SIZE {
+				let self::_sqlCache[sqlCacheKey] = sqlSelect;
+			}
 		}
 
 		/**
@@ -2788,15 +2875,37 @@ class Query implements QueryInterface, InjectionAwareInterface
 		/**
 		 * Execute the query
 		 */
-		let result = connection->query(sqlSelect, processed, processedTypes);
+		if this->_streaming {
 
-		/**
-		 * Check if the query has data
-		 */
-		if result instanceof ResultInterface && result->numRows() {
-			let resultData = result;
+			if typeof this->_cache == "object" {
+				throw new Exception("Streaming resultsets can't be cached");
+			}
+
+			/**
+			 * Streaming queries are unbuffered and never counted
+			 */
+			if method_exists(connection, "queryStream") {
+				let result = connection->{"queryStream"}(sqlSelect, processed, processedTypes);
+			} else {
+				let result = connection->query(sqlSelect, processed, processedTypes);
+			}
+
+			if result instanceof ResultInterface {
+				let resultData = result;
+			} else {
+				let resultData = false;
+			}
 		} else {
-			let resultData = false;
+			let result = connection->query(sqlSelect, processed, processedTypes);
+
+			/**
+			 * Check if the query has data
+			 */
+			if result instanceof ResultInterface && result->numRows() {
+				let resultData = result;
+			} else {
+				let resultData = false;
+			}
 		}
 
 		/**
@@ -2869,20 +2978,20 @@ class Query implements QueryInterface, InjectionAwareInterface
 						throw new Exception("Resultset class \"" . resultsetClassName . "\" must be an implementation of Phalcon\\Mvc\\Model\\ResultsetInterface");
 					}
 
-					return new {resultsetClassName}(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots);
+					return new {resultsetClassName}(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots, this->_streaming);
 				}
 			}
 
 			/**
 			 * Simple resultsets contains only complete objects
 			 */
-			return new Simple(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots);
+			return new Simple(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots, this->_streaming);
 		}
 
 		/**
 		 * Complex resultsets may contain complete objects and scalars
 		 */
-		return new Complex(columns1, resultData, cache);
+		return new Complex(columns1, resultData, cache, this->_streaming);
 	}
 
 	/**
@@ -2897,8 +3006,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 	{
 		var modelName, manager, connection, metaData, attributes,
 			fields, columnMap, dialect, insertValues, number, value, model,
-			values, exprValue, insertValue, wildcard, fieldName, attributeName,
-			insertModel;
+			values, insertValue, wildcard, fieldName, attributeName,
+			insertModel, expressions;
 		boolean automaticFields;
 
 		let modelName = intermediate["model"];
@@ -2939,18 +3048,18 @@ class Query implements QueryInterface, InjectionAwareInterface
 		/**
 		 * Get the dialect to resolve the SQL expressions
 		 */
-		let dialect = connection->getDialect();
+		let dialect = connection->getDialect(),
+			expressions = this->_getSqlExpressions(dialect, values);
 
 		let insertValues = [];
 		for number, value in values {
 
-			let exprValue = value["value"];
 			switch value["type"] {
 
 				case PHQL_T_STRING:
 				case PHQL_T_INTEGER:
 				case PHQL_T_DOUBLE:
-					let insertValue = dialect->getSqlExpression(exprValue);
+					let insertValue = expressions[number];
 					break;
 
 				case PHQL_T_NULL:
@@ -2965,7 +3074,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 						throw new Exception("Bound parameter cannot be replaced because placeholders is not an array");
 					}
 
-					let wildcard = str_replace(":", "", dialect->getSqlExpression(exprValue));
+					let wildcard = str_replace(":", "", expressions[number]);
 					if !fetch insertValue, bindParams[wildcard] {
 						throw new Exception(
 							"Bound parameter '" . wildcard . "' cannot be replaced because it isn't in the placeholders list"
@@ -2975,7 +3084,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 					break;
 
 				default:
-					let insertValue = new RawValue(dialect->getSqlExpression(exprValue));
+					let insertValue = new RawValue(expressions[number]);
 					break;
 			}
 
@@ -3025,7 +3134,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 		var models, modelName, model, connection, dialect,
 			fields, values, updateValues, fieldName, value,
 			selectBindParams, selectBindTypes, number, field,
-			records, exprValue, updateValue, wildcard, record;
+			records, updateValue, wildcard, record, expressions;
 
 		let models = intermediate["models"];
 
@@ -3047,7 +3156,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 		let dialect = connection->getDialect();
 
 		let fields = intermediate["fields"],
-			values = intermediate["values"];
+			values = intermediate["values"],
+			expressions = this->_getSqlExpressions(dialect, values);
 
 		/**
 		 * updateValues is applied to every record
@@ -3062,8 +3172,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 
 		for number, field in fields {
 
-			let value = values[number],
-				exprValue = value["value"];
+			let value = values[number];
 
 			if isset field["balias"] {
 				let fieldName = field["balias"];
@@ -3076,7 +3185,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 				case PHQL_T_STRING:
 				case PHQL_T_INTEGER:
 				case PHQL_T_DOUBLE:
-					let updateValue = dialect->getSqlExpression(exprValue);
+					let updateValue = expressions[number];
 					break;
 
 				case PHQL_T_NULL:
@@ -3091,7 +3200,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 						throw new Exception("Bound parameter cannot be replaced because placeholders is not an array");
 					}
 
-					let wildcard = str_replace(":", "", dialect->getSqlExpression(exprValue));
+					let wildcard = str_replace(":", "", expressions[number]);
 					if fetch updateValue, bindParams[wildcard] {
 						unset selectBindParams[wildcard];
 						unset selectBindTypes[wildcard];
@@ -3106,7 +3215,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 					throw new Exception("Not supported");
 
 				default:
-					let updateValue = new RawValue(dialect->getSqlExpression(exprValue));
+					let updateValue = new RawValue(expressions[number]);
 					break;
 			}
 
@@ -3241,6 +3350,37 @@ class Query implements QueryInterface, InjectionAwareInterface
 		return new Status(true);
 	}
 
+	/**
+	 * Returns the SQL expressions of the values of an INSERT/UPDATE, rendering
+	 * them only the first time the IR is executed with the dialect
+	 */
+	protected final function _getSqlExpressions(<DialectInterface> dialect, array! values) -> array
+	{
+		var sqlCacheKey = null, expressions, number, value;
+
+		if this->_irId !== null {
+			let sqlCacheKey = this->_irId . "|" . get_class(dialect) . "|values";
+			if fetch expressions, self::_sqlCache[sqlCacheKey] {
+				return expressions;
+			}
+		}
+
+		let expressions = [];
+		for number, value in values {
+			if value["type"] == PHQL_T_NULL {
+				let expressions[number] = null;
+			} else {
+				let expressions[number] = dialect->getSqlExpression(value["value"]);
+			}
+		}
+
+		if sqlCacheKey !== null && count(self::_sqlCache) < self::SQL_CACHE_SIZE {
+			let self::_sqlCache[sqlCacheKey] = expressions;
+		}
+
+		return expressions;
+	}
+
 	/**
 	 * Query the records on which the UPDATE/DELETE operation well be done
 	 *
@@ -3288,7 +3428,12 @@ class Query implements QueryInterface, InjectionAwareInterface
 		let query = new self();
 		query->setDI(this->_dependencyInjector);
 		query->setType(PHQL_T_SELECT);
-		query->setIntermediate(selectIr);
+
+		if this->_irId !== null {
+			query->setIntermediate(selectIr, this->_irId . "|related");
+		} else {
+			query->setIntermediate(selectIr);
+		}
 
 		return query->execute(bindParams, bindTypes);
 	}
@@ -3304,7 +3449,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 	{
 		var uniqueRow, cacheOptions, key, cacheService,
 			cache, result, preparedResult, defaultBindParams, mergedParams,
-			defaultBindTypes, mergedTypes, type, lifetime, intermediate;
+			defaultBindTypes, mergedTypes, type, lifetime, intermediate, e;
 
 		let uniqueRow = this->_uniqueRow;
 
@@ -3341,7 +3486,16 @@ class Query implements QueryInterface, InjectionAwareInterface
 				throw new Exception("Cache service must be an object");
 			}
 
-			let result = cache->get(key, lifetime);
+			/**
+			 * The backends protecting the computed contents let only one
+			 * process execute the query when the resultset expires
+			 */
+			if cache instanceof \Phalcon\Cache\Backend {
+				let result = cache->fetchOrLock(key, lifetime);
+			} else {
+				let result = cache->get(key, lifetime);
+			}
+
 			if result !== null {
 
 				if typeof result != "object" {
@@ -3359,6 +3513,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 					let preparedResult = result;
 				}
 
+				this->_eagerLoad(preparedResult);
+
 				return preparedResult;
 			}
 
@@ -3407,26 +3563,40 @@ class Query implements QueryInterface, InjectionAwareInterface
 		}
 
 		let type = this->_type;
-		switch type {
 
-			case PHQL_T_SELECT:
-				let result = this->_executeSelect(intermediate, mergedParams, mergedTypes);
-				break;
+		/**
+		 * The lock taken to compute the cached resultset is released if the
+		 * query fails, \Exception is checked first so PHP 5 never looks
+		 * \Throwable up
+		 */
+		try {
+			switch type {
+
+				case PHQL_T_SELECT:
+					let result = this->_executeSelect(intermediate, mergedParams, mergedTypes);
+					break;
 
-			case PHQL_T_INSERT:
-				let result = this->_executeInsert(intermediate, mergedParams, mergedTypes);
-				break;
+				case PHQL_T_INSERT:
+					let result = this->_executeInsert(intermediate, mergedParams, mergedTypes);
+					break;
 
-			case PHQL_T_UPDATE:
-				let result = this->_executeUpdate(intermediate, mergedParams, mergedTypes);
-				break;
+				case PHQL_T_UPDATE:
+					let result = this->_executeUpdate(intermediate, mergedParams, mergedTypes);
+					break;
 
-			case PHQL_T_DELETE:
-				let result = this->_executeDelete(intermediate, mergedParams, mergedTypes);
-				break;
+				case PHQL_T_DELETE:
+					let result = this->_executeDelete(intermediate, mergedParams, mergedTypes);
+					break;
 
-			default:
-				throw new Exception("Unknown statement " . type);
+				default:
+					throw new Exception("Unknown statement " . type);
+			}
+		} catch \Exception|\Throwable, e {
+			if cacheOptions !== null && cache instanceof \Phalcon\Cache\Backend {
+				cache->abortCompute(key);
+			}
+
+			throw e;
 		}
 
 		/**
@@ -3438,10 +3608,18 @@ class Query implements QueryInterface, InjectionAwareInterface
 			 * Only PHQL SELECTs can be cached
 			 */
 			if type != PHQL_T_SELECT {
+				if cache instanceof \Phalcon\Cache\Backend {
+					cache->abortCompute(key);
+				}
+
 				throw new Exception("Only PHQL statements that return resultsets can be cached");
 			}
 
-			cache->save(key, result, lifetime);
+			if cache instanceof \Phalcon\Cache\Backend {
+				cache->saveComputed(key, result, lifetime);
+			} else {
+				cache->save(key, result, lifetime);
+			}
 		}
 
 		/**
@@ -3453,6 +3631,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 			let preparedResult = result;
 		}
 
+		this->_eagerLoad(preparedResult);
+
 		return preparedResult;
 	}
 
@@ -3565,11 +3745,23 @@ class Query implements QueryInterface, InjectionAwareInterface
 	}
 
 	/**
-	 * Allows to set the IR to be executed
+	 * Sets the AST of the PHQL statement so it is not parsed again, its "id"
+	 * is the key of the prepared statement in the cache
 	 */
-	public function setIntermediate(array! intermediate) -> <Query>
+	public function setAst(array! ast) -> <Query>
 	{
-		let this->_intermediate = intermediate;
+		let this->_ast = ast;
+		return this;
+	}
+
+	/**
+	 * Allows to set the IR to be executed. IRs with an id have their SQL
+	 * cached, the id must change every time the IR changes
+	 */
+	public function setIntermediate(array! intermediate, var intermediateId = null) -> <Query>
+	{
+		let this->_intermediate = intermediate,
+			this->_irId = intermediateId;
 		return this;
 	}
 
@@ -3621,12 +3813,187 @@ class Query implements QueryInterface, InjectionAwareInterface
 		throw new Exception("This type of statement generates multiple SQL statements");
 	}
 
+	/**
+	 * Sets whether SELECTs must return forward-only streaming resultsets.
+	 * Streaming resultsets use unbuffered queries or server-side cursors when
+	 * the database system supports them, are never counted and hydrate one
+	 * record at a time, so the memory used doesn't depend on the number of rows
+	 *
+	 *<code>
+	 * $query->setStreaming(true);
+	 *
+	 * foreach ($query->execute() as $robot) {
+	 *     echo $robot->name, PHP_EOL;
+	 * }
+	 *</code>
+	 */
+	public function setStreaming(boolean streaming) -> <Query>
+	{
+		let this->_streaming = streaming;
+		return this;
+	}
+
+	/**
+	 * Checks whether SELECTs return forward-only streaming resultsets
+	 */
+	public function isStreaming() -> boolean
+	{
+		return this->_streaming;
+	}
+
+	/**
+	 * Sets the relations to eager load on the records returned by the query
+	 *
+	 *<code>
+	 * $query->setWith(["robotsParts", "robotsParts.parts"]);
+	 *</code>
+	 */
+	public function setWith(var relations) -> <Query>
+	{
+		let this->_with = relations;
+		return this;
+	}
+
+	/**
+	 * Returns the relations eager loaded on the records returned by the query
+	 */
+	public function getWith()
+	{
+		return this->_with;
+	}
+
+	/**
+	 * Eager loads the relations on the records returned by a SELECT
+	 */
+	protected function _eagerLoad(var result) -> void
+	{
+		var relations;
+
+		let relations = this->_with;
+		if empty relations || typeof result != "object" {
+			return;
+		}
+
+		/**
+		 * Queries of scalar columns return rows without relations
+		 */
+		if result instanceof Simple {
+			if result->hasCompleteRecords() {
+				result->with(relations);
+			}
+		} elseif result instanceof ModelInterface {
+			this->_manager->eagerLoad(result, relations);
+		}
+	}
+
 	/**
 	 * Destroys the internal PHQL cache
 	 */
 	public static function clean()
 	{
-		let self::_irPhqlCache = [];
+		let self::_irPhqlCache = [],
+			self::_sqlCache = [];
+	}
+
+	/**
+	 * Destroys the cross-request PHQL cache shared by all the processes
+	 */
+	public static function cleanPersistent() -> boolean
+	{
+		var iterator;
+
+		let self::_irPhqlCache = [],
+			self::_sqlCache = [];
+
+		if !function_exists("apcu_delete") {
+			return false;
+		}
+
+		// The APCu 4.x only has APCIterator, not the newer APCUIterator
+		if class_exists("APCUIterator") {
+			let iterator = new \APCUIterator("/^_PHQL/");
+		} elseif class_exists("APCIterator") {
+			let iterator = new \APCIterator("user", "/^_PHQL/");
+		} else {
+			return false;
+		}
+
+		return apcu_delete(iterator);
+	}
+
+	/**
+	 * Returns the key used to store a PHQL statement in the cross-request cache
+	 */
+	protected static function getPersistentCacheKey(string! phql) -> string
+	{
+		var metaDataVersion;
+
+		let metaDataVersion = globals_get("orm.metadata_version");
+
+		return "_PHQL" . metaDataVersion . "_" . md5(phql);
+	}
+
+	/**
+	 * Reads a prepared PHQL statement from the cross-request cache
+	 */
+	protected static function fetchPersistentCache(string! key) -> array | boolean
+	{
+		var persistent;
+
+		if !function_exists("apcu_fetch") {
+			return false;
+		}
+
+		let persistent = apcu_fetch(key);
+		if typeof persistent != "array" {
+			return false;
+		}
+
+		return persistent;
+	}
+
+	/**
+	 * Stores a prepared PHQL statement in the cross-request cache. Stored
+	 * statements are never overwritten and no more statements are stored
+	 * once the "orm.persistent_phql_cache_size" limit is reached. The
+	 * counter only includes the statements actually added, so statements
+	 * stored by another process in the meantime aren't counted twice
+	 */
+	protected static function storePersistentCache(string! key, array! persistent) -> boolean
+	{
+		var metaDataVersion, cacheSize, counterKey, stored;
+
+		if !function_exists("apcu_add") {
+			return false;
+		}
+
+		let metaDataVersion = globals_get("orm.metadata_version"),
+			cacheSize = globals_get("orm.persistent_phql_cache_size"),
+			counterKey = "_PHQL" . metaDataVersion . "_count";
+
+		let stored = apcu_fetch(counterKey);
+		if typeof stored == "integer" && stored >= cacheSize {
+			return false;
+		}
+
+		if !apcu_add(key, persistent) {
+			return false;
+		}
+
+		apcu_add(counterKey, 0);
+
+		/**
+		 * Processes adding statements at the same time can exceed the
+		 * limit, the statements over it are removed again
+		 */
+		let stored = apcu_inc(counterKey);
+		if typeof stored != "integer" || stored > cacheSize {
+			apcu_delete(key);
+			apcu_dec(counterKey);
+			return false;
+		}
+
+		return true;
 	}
 
 	/**
@@ -72,7 +72,7 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 	protected _joins;
 
 	/**
-	 * @deprecated Will be removed in version 4.0.0
+	 * Relations eager loaded on the records returned by the query
 	 */
 	protected _with;
 
@@ -100,6 +100,10 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 
 	protected _hiddenParamNumber = 0;
 
+	static protected _astCache;
+
+	const AST_CACHE_SIZE = 1024;
+
 	/**
 	 * Phalcon\Mvc\Model\Query\Builder constructor
 	 */
@@ -110,7 +114,7 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 			singleConditionArray, limit, offset, fromClause,
 			mergedConditions, mergedParams, mergedTypes,
 			singleCondition, singleParams, singleTypes,
-			distinct, bind, bindTypes;
+			distinct, bind, bindTypes, withClause;
 
 		if typeof params == "array" {
 
@@ -252,6 +256,13 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 				let this->_offset = offsetClause;
 			}
 
+			/**
+			 * Assign the relations to eager load
+			 */
+			if fetch withClause, params["with"] {
+				let this->_with = withClause;
+			}
+
 			/**
 			 * Assign FOR UPDATE clause
 			 */
@@ -537,6 +548,37 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 		return this->_joins;
 	}
 
+	/**
+	 * Sets the relations to eager load on the returned records. Every
+	 * relation is loaded with a single query instead of one query per record
+	 *
+	 *<code>
+	 * $builder->with("robotsParts");
+	 *
+	 * $builder->with(
+	 *     [
+	 *         "robotsParts" => [
+	 *             "order" => "id DESC",
+	 *         ],
+	 *         "robotsParts.parts",
+	 *     ]
+	 * );
+	 *</code>
+	 */
+	public function with(var relations) -> <Builder>
+	{
+		let this->_with = relations;
+		return this;
+	}
+
+	/**
+	 * Returns the relations to eager load
+	 */
+	public function getWith()
+	{
+		return this->_with;
+	}
+
 	/**
 	 * Sets the query WHERE conditions
 	 *
@@ -1039,15 +1081,26 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 	 */
 	public final function getPhql() -> string
 	{
-		var dependencyInjector, models, conditions, model, metaData,
+		return join("", this->_getClauses());
+	}
+
+	/**
+	 * Returns the PHQL of every clause of the statement built, indexed by the
+	 * name of the clause in the AST returned by the PHQL parser
+	 */
+	protected function _getClauses() -> array
+	{
+		var dependencyInjector, clauses, models, conditions, model, metaData,
 			modelInstance, primaryKeys, firstPrimaryKey, columnMap, modelAlias,
 			attributeField, phql, column, columns, selectedColumns, selectedColumn,
 			selectedModel, selectedModels, columnAlias, modelColumnAlias,
 			joins, join, joinModel, joinConditions, joinAlias, joinType, group,
 			groupItems, groupItem, having, order, orderItems, orderItem,
-			limit, number, offset, forUpdate, distinct;
+			limit, number, offset, forUpdate, distinct, limitClause;
 		boolean noPrimary;
 
+		let clauses = [];
+
 		let dependencyInjector = this->_dependencyInjector;
 		if typeof dependencyInjector != "object" {
 			let dependencyInjector = Di::getDefault(),
@@ -1256,10 +1309,12 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 			}
 		}
 
+		let clauses["select"] = phql;
+
 		// Only append where conditions if it's string
 		if typeof conditions == "string" {
 			if !empty conditions {
-				let phql .= " WHERE " . conditions;
+				let clauses["where"] = " WHERE " . conditions;
 			}
 		}
 
@@ -1281,7 +1336,7 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 				let groupItems[] = this->autoescape(groupItem);
 			}
 
-			let phql .= " GROUP BY " . join(", ", groupItems);
+			let clauses["groupBy"] = " GROUP BY " . join(", ", groupItems);
 		}
 
 		/**
@@ -1290,7 +1345,7 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 		let having = this->_having;
 		if having !== null {
 			if !empty having {
-				let phql .= " HAVING " . having;
+				let clauses["having"] = " HAVING " . having;
 			}
 		}
 
@@ -1322,9 +1377,9 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 					let orderItems[] = this->autoescape(orderItem);
 				}
 
-				let phql .= " ORDER BY " . join(", ", orderItems);
+				let clauses["orderBy"] = " ORDER BY " . join(", ", orderItems);
 			} else {
-				let phql .= " ORDER BY " . order;
+				let clauses["orderBy"] = " ORDER BY " . order;
 			}
 		}
 
@@ -1358,26 +1413,28 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 
 			if is_numeric(number) {
 
-				let phql .= " LIMIT :APL0:",
+				let limitClause = " LIMIT :APL0:",
 					this->_bindParams["APL0"] = intval(number, 10),
 					this->_bindTypes["APL0"] = Column::BIND_PARAM_INT;
 
 				if is_numeric(offset) {
-					let phql .= " OFFSET :APL1:",
+					let limitClause .= " OFFSET :APL1:",
 						this->_bindParams["APL1"] = intval(offset, 10),
 						this->_bindTypes["APL1"] = Column::BIND_PARAM_INT;
 				}
+
+				let clauses["limit"] = limitClause;
 			}
 		}
 
 		let forUpdate = this->_forUpdate;
 		if typeof forUpdate === "boolean" {
 			if forUpdate {
-				let phql .= " FOR UPDATE";
+				let clauses["forUpdate"] = " FOR UPDATE";
 			}
 		}
 
-		return phql;
+		return clauses;
 	}
 
 	/**
@@ -1385,9 +1442,10 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 	 */
 	public function getQuery() -> <QueryInterface>
 	{
-		var query, bindParams, bindTypes, phql, dependencyInjector;
+		var query, bindParams, bindTypes, phql, dependencyInjector, clauses, ast;
 
-		let phql = this->getPhql();
+		let clauses = this->_getClauses(),
+			phql = join("", clauses);
 
 		let dependencyInjector = <DiInterface> this->_dependencyInjector;
 		if typeof dependencyInjector != "object" {
@@ -1402,6 +1460,18 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 			[phql, dependencyInjector]
 		);
 
+		/**
+		 * The AST is assembled from the clauses parsed by previous builders,
+		 * so the statement is neither scanned nor parsed again
+		 */
+		if query instanceof \Phalcon\Mvc\Model\Query {
+			let ast = this->_getAst(clauses);
+			if typeof ast == "array" {
+				let ast["id"] = "_PHQB" . md5(phql);
+				query->setAst(ast);
+			}
+		}
+
 		// Set default bind params
 		let bindParams = this->_bindParams;
 		if typeof bindParams == "array" {
@@ -1418,9 +1488,60 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 			query->setSharedLock(this->_sharedLock);
 		}
 
+		// Set the relations to eager load
+		if !empty this->_with {
+			query->setWith(this->_with);
+		}
+
 		return query;
 	}
 
+	/**
+	 * Returns the AST of a SELECT from the PHQL of its clauses. Every clause
+	 * is parsed once and its AST is reused by the builders producing the same
+	 * clause. False is returned if a clause can't be parsed, the query then
+	 * parses the whole statement reporting the error as usual
+	 */
+	protected function _getAst(array! clauses) -> array | boolean
+	{
+		var ast, clause, phql, fragment, e;
+
+		let ast = ["type": PHQL_T_SELECT];
+
+		for clause, phql in clauses {
+
+			if !fetch fragment, self::_astCache[phql] {
+
+				/**
+				 * The clauses following the SELECT are parsed after a dummy one
+				 */
+				try {
+					if clause == "select" {
+						let fragment = phql_parse_phql(phql);
+					} else {
+						let fragment = phql_parse_phql("SELECT * FROM [_]" . phql);
+					}
+				} catch Exception, e {
+					return false;
+				}
+
+				if typeof fragment != "array" || !fetch fragment, fragment[clause] {
+					return false;
+				}
+
+				if count(self::_astCache) >= self::AST_CACHE_SIZE {
+					let self::_astCache = [];
+				}
+
+				let self::_astCache[phql] = fragment;
+			}
+
+			let ast[clause] = fragment;
+		}
+
+		return ast;
+	}
+
 	/**
 	 * Automatically escapes identifiers but only if they need to be escaped.
 	 */
@@ -95,6 +95,11 @@ abstract class Resultset
 
 	protected _hydrateMode = 0;
 
+	/**
+	 * Streaming resultsets are forward-only and fetch one row at a time
+	 */
+	protected _streaming = false;
+
 	const TYPE_RESULT_FULL = 0;
 
 	const TYPE_RESULT_PARTIAL = 1;
@@ -110,8 +115,9 @@ abstract class Resultset
 	 *
 	 * @param \Phalcon\Db\ResultInterface|false result
 	 * @param \Phalcon\Cache\BackendInterface cache
+	 * @param boolean streaming
 	 */
-	public function __construct(result, <BackendInterface> cache = null)
+	public function __construct(result, <BackendInterface> cache = null, boolean streaming = false)
 	{
 		var rowCount, rows;
 
@@ -141,6 +147,14 @@ abstract class Resultset
 		 */
 		result->setFetchMode(Db::FETCH_ASSOC);
 
+		/**
+		 * Streaming resultsets are never counted nor prefetched
+		 */
+		if streaming {
+			let this->_streaming = true;
+			return;
+		}
+
 		/**
 		 * Update the row-count
 		 */
@@ -185,6 +199,13 @@ abstract class Resultset
 	 */
 	public function valid() -> boolean
 	{
+		if this->_streaming {
+			if this->_row === null {
+				this->seek(this->_pointer);
+			}
+			return typeof this->_row == "array";
+		}
+
 		return this->_pointer < this->_count;
 	}
 
@@ -193,6 +214,10 @@ abstract class Resultset
 	 */
 	public function key() -> int | null
 	{
+		if this->_streaming {
+			return typeof this->_row == "array" ? this->_pointer : null;
+		}
+
 		if this->_pointer >= this->_count {
 			return null;
 		}
@@ -217,6 +242,29 @@ abstract class Resultset
 		var result, row;
 
 		if this->_pointer != position || this->_row === null {
+
+			/**
+			 * Streaming resultsets can only move forward
+			 */
+			if this->_streaming {
+				if position < this->_pointer {
+					throw new Exception("Streaming resultsets can only be traversed forward");
+				}
+
+				let result = this->_result;
+				if this->_row === null {
+					let this->_row = result->$fetch();
+				}
+
+				while this->_pointer < position {
+					let this->_row = result->$fetch();
+					let this->_pointer++;
+				}
+
+				let this->_activeRow = null;
+				return;
+			}
+
 			if typeof this->_rows == "array" {
 				/**
 				* All rows are in memory
@@ -272,9 +320,21 @@ abstract class Resultset
 	 */
 	public final function count() -> int
 	{
+		if this->_streaming {
+			throw new Exception("Streaming resultsets can't be counted");
+		}
+
 		return this->_count;
 	}
 
+	/**
+	 * Checks whether the resultset is a forward-only stream of rows
+	 */
+	public function isStreaming() -> boolean
+	{
+		return this->_streaming;
+	}
+
 	/**
 	 * Checks whether offset exists in the resultset
 	 */
@@ -332,7 +392,7 @@ abstract class Resultset
 	 */
 	public function getFirst() -> <ModelInterface> | boolean
 	{
-		if this->_count == 0 {
+		if this->_count == 0 && !this->_streaming {
 			return false;
 		}
 
@@ -346,6 +406,11 @@ abstract class Resultset
 	public function getLast() -> <ModelInterface> | boolean
 	{
 		var count;
+
+		if this->_streaming {
+			throw new Exception("Streaming resultsets can only be traversed forward");
+		}
+
 		let count = this->_count;
 		if count == 0 {
 			return false;
@@ -355,6 +420,59 @@ abstract class Resultset
 		return this->{"current"}();
 	}
 
+	/**
+	 * Keeps only the first rows of the resultset, optionally in reverse
+	 * order, and returns whether any row was removed. It's used to fetch one
+	 * row more than required to know whether there are more rows
+	 *
+	 *<code>
+	 * $robots = Robots::find(["limit" => 11]);
+	 *
+	 * $hasMore = $robots->limitRows(10);
+	 *</code>
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function limitRows(int limit, boolean reverse = false) -> boolean
+	{
+		var rows, result;
+		boolean removed;
+
+		if this->_streaming {
+			throw new Exception("Streaming resultsets can't be limited");
+		}
+
+		let rows = this->_rows;
+		if typeof rows != "array" {
+			let result = this->_result;
+			if this->_row !== null {
+				result->execute();
+			}
+
+			let rows = result->fetchAll();
+			if typeof rows != "array" {
+				let rows = [];
+			}
+		}
+
+		let removed = count(rows) > limit;
+		if removed {
+			let rows = array_slice(rows, 0, limit);
+		}
+
+		if reverse {
+			let rows = array_reverse(rows);
+		}
+
+		let this->_rows = rows,
+			this->_count = count(rows),
+			this->_pointer = 0,
+			this->_row = null,
+			this->_activeRow = null;
+
+		return removed;
+	}
+
 	/**
 	 * Set if the resultset is fresh or an old one cached
 	 */
@@ -555,6 +673,145 @@ abstract class Resultset
 		return result;
 	}
 
+	/**
+	 * Saves every record in the resultset with the given data assigned. With
+	 * fireEvents the records are saved one by one in a transaction, as
+	 * update() does. Otherwise their columns are written back with multi-row
+	 * upserts of chunkSize rows, skipping validations and events
+	 *
+	 *<code>
+	 * $robots = Robots::find("type = 'mechanical'");
+	 *
+	 * $robots->saveAll(["type" => "virtual"], false);
+	 *</code>
+	 *
+	 * @todo Add to the interface for 4.0.0
+	 */
+	public function saveAll(var data = null, boolean fireEvents = true, int chunkSize = 500) -> boolean
+	{
+		boolean transaction;
+		var record, connection = null, metaData = null, columnMap = null,
+			fields = null, rows, rowValues, field, attribute, bindTypes,
+			bindType, dataTypes, schema, source, table;
+
+		let transaction = false,
+			rows = [];
+
+		this->rewind();
+
+		while this->valid() {
+
+			let record = this->current();
+
+			if transaction === false {
+
+				/**
+				 * We only can save resultsets if every element is a complete object
+				 */
+				if !method_exists(record, "getWriteConnection") {
+					throw new Exception("The returned record is not valid");
+				}
+
+				let connection = record->getWriteConnection(),
+					metaData = record->getModelsMetaData(),
+					fields = metaData->getAttributes(record),
+					transaction = true;
+
+				if globals_get("orm.column_renaming") {
+					let columnMap = metaData->getColumnMap(record);
+				}
+
+				connection->begin();
+			}
+
+			if fireEvents {
+
+				/**
+				 * Try to save the record
+				 */
+				if !record->save(data) {
+
+					/**
+					 * Get the messages from the record that produce the error
+					 */
+					let this->_errorMessages = record->getMessages();
+
+					connection->rollback();
+					return false;
+				}
+			} else {
+
+				if typeof data == "array" {
+					record->assign(data);
+				}
+
+				let rowValues = [];
+				for field in fields {
+					if typeof columnMap == "array" {
+						let attribute = columnMap[field];
+					} else {
+						let attribute = field;
+					}
+
+					let rowValues[] = record->readAttribute(attribute);
+				}
+
+				let rows[] = rowValues;
+			}
+
+			this->next();
+		}
+
+		if transaction === false {
+			return true;
+		}
+
+		if count(rows) {
+
+			let bindTypes = metaData->getBindTypes(record),
+				dataTypes = [];
+
+			for field in fields {
+				if !fetch bindType, bindTypes[field] {
+					connection->rollback();
+					throw new Exception("Column '" . field . "' have not defined a bind data type");
+				}
+
+				let dataTypes[] = bindType;
+			}
+
+			let schema = record->getSchema(),
+				source = record->getSource();
+
+			if schema {
+				let table = [schema, source];
+			} else {
+				let table = source;
+			}
+
+			/**
+			 * The records already exist, so the rows conflict with them by
+			 * their primary key and every other column is updated
+			 */
+			if !connection->{"upsertMultiple"}(
+				table,
+				rows,
+				fields,
+				metaData->getNonPrimaryKeyAttributes(record),
+				metaData->getPrimaryKeyAttributes(record),
+				dataTypes,
+				chunkSize
+			) {
+				connection->rollback();
+				return false;
+			}
+		}
+
+		connection->commit();
+
+		return true;
+	}
+
 	/**
 	 * Filters a resultset returning only those the developer requires
 	 *
@@ -49,14 +49,14 @@ class Complex extends Resultset implements ResultsetInterface
 	 * @param \Phalcon\Db\ResultInterface result
 	 * @param \Phalcon\Cache\BackendInterface cache
 	 */
-	public function __construct(var columnTypes, <ResultInterface> result = null, <BackendInterface> cache = null)
+	public function __construct(var columnTypes, <ResultInterface> result = null, <BackendInterface> cache = null, boolean streaming = false)
 	{
 		/**
 		 * Column types, tell the resultset how to build the result
 		 */
 		let this->_columnTypes = columnTypes;
 
-		parent::__construct(result, cache);
+		parent::__construct(result, cache, streaming);
 	}
 
 	/**
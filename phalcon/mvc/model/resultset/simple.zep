@@ -39,6 +39,10 @@ class Simple extends Resultset
 
 	protected _keepSnapshots = false;
 
+	protected _hydrationPlan;
+
+	protected _eagerLoads = [];
+
 	/**
 	 * Phalcon\Mvc\Model\Resultset\Simple constructor
 	 *
@@ -47,8 +51,9 @@ class Simple extends Resultset
 	 * @param \Phalcon\Db\Result\Pdo|null result
 	 * @param \Phalcon\Cache\BackendInterface cache
 	 * @param boolean keepSnapshots
+	 * @param boolean streaming
 	 */
-	public function __construct(var columnMap, var model, result, <BackendInterface> cache = null, keepSnapshots = null)
+	public function __construct(var columnMap, var model, result, <BackendInterface> cache = null, keepSnapshots = null, boolean streaming = false)
 	{
 		let this->_model = model,
 			this->_columnMap = columnMap;
@@ -58,7 +63,7 @@ class Simple extends Resultset
 		 */
 		let this->_keepSnapshots = keepSnapshots;
 
-		parent::__construct(result, cache);
+		parent::__construct(result, cache, streaming);
 	}
 
 	/**
@@ -66,7 +71,7 @@ class Simple extends Resultset
 	 */
 	public final function current() -> <ModelInterface> | boolean
 	{
-		var row, hydrateMode, columnMap, activeRow, modelName;
+		var row, hydrateMode, columnMap, activeRow, modelName, hydrationPlan;
 
 		let activeRow = this->_activeRow;
 		if activeRow !== null {
@@ -96,6 +101,16 @@ class Simple extends Resultset
 		 */
 		let columnMap = this->_columnMap;
 
+		/**
+		 * All the rows have the same columns so the column map is resolved
+		 * only for the first one
+		 */
+		let hydrationPlan = this->_hydrationPlan;
+		if typeof hydrationPlan != "array" {
+			let hydrationPlan = Model::getHydrationPlan(row, columnMap),
+				this->_hydrationPlan = hydrationPlan;
+		}
+
 		/**
 		 * Hydrate based on the current hydration
 		 */
@@ -123,9 +138,10 @@ class Simple extends Resultset
 						this->_keepSnapshots
 					);
 				} else {
-					let activeRow = Model::cloneResultMap(
+					let activeRow = Model::cloneResultMapPlan(
 						this->_model,
 						row,
+						hydrationPlan,
 						columnMap,
 						Model::DIRTY_STATE_PERSISTENT,
 						this->_keepSnapshots
@@ -137,14 +153,92 @@ class Simple extends Resultset
 				/**
 				 * Other kinds of hydrations
 				 */
-				let activeRow = Model::cloneResultMapHydrate(row, columnMap, hydrateMode);
+				if typeof columnMap != "array" && hydrateMode == Resultset::HYDRATE_ARRAYS {
+					let activeRow = row;
+				} else {
+					let activeRow = Model::cloneResultMapHydratePlan(row, hydrationPlan, hydrateMode);
+				}
 				break;
 		}
 
+		/**
+		 * Assign the eager loaded relations
+		 */
+		if hydrateMode == Resultset::HYDRATE_RECORDS && count(this->_eagerLoads) {
+			this->_model->getModelsManager()->assignEagerLoads(activeRow, this->_eagerLoads);
+		}
+
 		let this->_activeRow = activeRow;
 		return activeRow;
 	}
 
+	/**
+	 * Loads the given relations of every record in the resultset issuing one
+	 * query per relation. The related records are assigned to the records as
+	 * they are hydrated
+	 *
+	 *<code>
+	 * $robots = Robots::find()->with(["robotsParts", "robotsParts.parts"]);
+	 *
+	 * foreach ($robots as $robot) {
+	 *     foreach ($robot->robotsParts as $robotPart) {
+	 *         echo $robotPart->parts->name, PHP_EOL;
+	 *     }
+	 * }
+	 *</code>
+	 */
+	public function with(var relations) -> <Simple>
+	{
+		var model;
+
+		if !this->hasCompleteRecords() {
+			throw new Exception("Relations can only be eager loaded on resultsets of complete records");
+		}
+
+		if this->_streaming {
+			throw new Exception("Relations can't be eager loaded on streaming resultsets");
+		}
+
+		let model = this->_model,
+			this->_eagerLoads = model->getModelsManager()->getEagerLoads(
+			get_class(model),
+			this->toArray(),
+			relations
+		);
+
+		let this->_activeRow = null;
+
+		return this;
+	}
+
+	/**
+	 * Checks whether the resultset returns complete records of a model instead
+	 * of rows with scalar columns
+	 */
+	public function hasCompleteRecords() -> boolean
+	{
+		return this->_model instanceof Model;
+	}
+
+	/**
+	 * Replaces the rows of the resultset by rows fetched with the same column
+	 * map. It's used to assign the related records loaded by with()
+	 */
+	public function assignRows(array! rows, array! eagerLoads = []) -> <Simple>
+	{
+		let this->_result = false,
+			this->_rows = rows,
+			this->_count = count(rows),
+			this->_eagerLoads = eagerLoads,
+			this->_pointer = 0,
+			this->_row = null,
+			this->_activeRow = null,
+			this->_streaming = false,
+			this->_isFresh = true;
+
+		return this;
+	}
+
 	/**
 	 * Returns a complete resultset as an array, if the resultset has a big number of rows
 	 * it could consume more memory than currently it does. Export the resultset to an array
@@ -95,6 +95,10 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 
 	protected _notFoundPaths;
 
+	protected _useCompiledRoutes = false;
+
+	protected _compiledRoutes;
+
 	const URI_SOURCE_GET_URL = 0;
 
 	const URI_SOURCE_SERVER_REQUEST_URI = 1;
@@ -216,6 +220,117 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 		return this;
 	}
 
+	/**
+	 * Set whether router must match the routes through a compiled route table.
+	 * The table groups routes by HTTP method and by the literal first segment
+	 * of their pattern, so only the routes that can match the handled URI are
+	 * checked, in the same order and with the same semantics as the default
+	 * linear scan
+	 *
+	 *<code>
+	 * $router->useCompiledRoutes(true);
+	 *</code>
+	 */
+	public function useCompiledRoutes(boolean! compiled = true) -> <RouterInterface>
+	{
+		let this->_useCompiledRoutes = compiled;
+		return this;
+	}
+
+	/**
+	 * Checks whether the router matches through the compiled route table
+	 */
+	public function isUsingCompiledRoutes() -> boolean
+	{
+		return this->_useCompiledRoutes;
+	}
+
+	/**
+	 * Builds the compiled route table used when compiled matching is enabled.
+	 * The table is rebuilt automatically after adding, mounting or clearing
+	 * routes. Routes modified after being handled must be recompiled by
+	 * calling this method again
+	 */
+	public function compileRoutes() -> array
+	{
+		var route, methods, method, entries, entry, keys, key, segments,
+			wildcards, segment, segmentName, routesList, table;
+
+		let entries = [],
+			keys = ["*": true];
+
+		for route in this->_routes {
+			let methods = route->getHttpMethods();
+
+			if typeof methods == "string" {
+				let methods = [methods];
+			}
+
+			if typeof methods == "array" {
+				for method in methods {
+					let keys[method] = true;
+				}
+			}
+
+			let entries[] = [route, methods, this->getRouteSegment(route->getCompiledPattern())];
+		}
+
+		let table = [];
+
+		/**
+		 * Every HTTP method gets its own index, the '*' key is used by the
+		 * methods that are not constrained by any route
+		 */
+		for key in array_keys(keys) {
+			let segments = [],
+				wildcards = [];
+
+			for entry in entries {
+				let methods = entry[1];
+
+				if typeof methods == "array" {
+					if key === "*" || !in_array(key, methods) {
+						continue;
+					}
+				}
+
+				let route = entry[0],
+					segment = entry[2];
+
+				if segment === false {
+
+					/**
+					 * Routes without a literal first segment can match any
+					 * URI so they are appended to every list
+					 */
+					let wildcards[] = route;
+
+					for segmentName in array_keys(segments) {
+						let routesList = segments[segmentName],
+							routesList[] = route,
+							segments[segmentName] = routesList;
+					}
+				} else {
+					if !fetch routesList, segments[segment] {
+						let routesList = wildcards;
+					}
+
+					let routesList[] = route,
+						segments[segment] = routesList;
+				}
+			}
+
+			let table[key] = [
+				"segments":  segments,
+				"wildcards": wildcards
+			];
+		}
+
+		let this->_compiledRoutes = table;
+
+		return table;
+	}
+
 	/**
 	 * Sets the name of the default namespace
 	 */
@@ -329,7 +444,8 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 			vnamespace, module,  controller, action, paramsStr, strParams,
 			route, methods, dependencyInjector,
 			hostname, regexHostName, matched, pattern, handledUri, beforeMatch,
-			paths, converters, part, position, matchPosition, converter, eventsManager;
+			paths, converters, part, position, matchPosition, converter, eventsManager,
+			routes;
 
 		if !uri {
 			/**
@@ -364,10 +480,16 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 			eventsManager->fire("router:beforeCheckRoutes", this);
 		}
 
+		if this->_useCompiledRoutes {
+			let routes = this->getCandidateRoutes(handledUri);
+		} else {
+			let routes = this->_routes;
+		}
+
 		/**
 		 * Routes are traversed in reversed order
 		 */
-		for route in reverse this->_routes {
+		for route in reverse routes {
 			let params = [],
 				matches = null;
 
@@ -707,6 +829,8 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 				throw new Exception("Invalid route position");
 		}
 
+		let this->_compiledRoutes = null;
+
 		return this;
 	}
 
@@ -861,6 +985,8 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 			let this->_routes = groupRoutes;
 		}
 
+		let this->_compiledRoutes = null;
+
 		return this;
 	}
 
@@ -881,7 +1007,8 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 	 */
 	public function clear() -> void
 	{
-		let this->_routes = [];
+		let this->_routes = [],
+			this->_compiledRoutes = null;
 	}
 
 	/**
@@ -994,4 +1121,101 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 	{
 		return true;
 	}
+
+	/**
+	 * Returns the routes of the compiled route table that can match the URI
+	 */
+	protected function getCandidateRoutes(string! handledUri) -> array
+	{
+		var table, dependencyInjector, request, bucket, segments, routes,
+			segment, position;
+
+		let table = this->_compiledRoutes;
+		if typeof table != "array" {
+			let table = this->compileRoutes();
+		}
+
+		/**
+		 * The request is only required if there are routes constrained by
+		 * HTTP methods
+		 */
+		if count(table) > 1 {
+			let dependencyInjector = <DiInterface> this->_dependencyInjector;
+			if typeof dependencyInjector != "object" {
+				throw new Exception("A dependency injection container is required to access the 'request' service");
+			}
+
+			let request = <RequestInterface> dependencyInjector->getShared("request");
+
+			if !fetch bucket, table[request->getMethod()] {
+				let bucket = table["*"];
+			}
+		} else {
+			let bucket = table["*"];
+		}
+
+		/**
+		 * URIs not starting with a slash can't be indexed by segment
+		 */
+		if !starts_with(handledUri, "/") {
+			return this->_routes;
+		}
+
+		let position = strpos(handledUri, "/", 1);
+		if position === false {
+			let segment = substr(handledUri, 1);
+		} else {
+			let segment = substr(handledUri, 1, position - 1);
+		}
+
+		let segments = bucket["segments"];
+		if fetch routes, segments[segment] {
+			return routes;
+		}
+
+		return bucket["wildcards"];
+	}
+
+	/**
+	 * Returns the literal first segment of a compiled pattern or false if the
+	 * pattern can match more than one first segment
+	 */
+	protected function getRouteSegment(string! pattern) -> string | boolean
+	{
+		var matches, position;
+
+		/**
+		 * Patterns without regular expressions are compared as is
+		 */
+		if !memstr(pattern, "^") {
+			if !starts_with(pattern, "/") {
+				return false;
+			}
+
+			let position = strpos(pattern, "/", 1);
+			if position === false {
+				return (string) substr(pattern, 1);
+			}
+
+			return (string) substr(pattern, 1, position - 1);
+		}
+
+		/**
+		 * Alternations and case-insensitive patterns are never indexed
+		 */
+		if memstr(pattern, "|") {
+			return false;
+		}
+
+		if !ends_with(pattern, "#") && !ends_with(pattern, "#u") {
+			return false;
+		}
+
+		let matches = null;
+		if !preg_match("~^#\\^/([\\w\\-]*)(?:/|\\$#u?$)~", pattern, matches) {
+			return false;
+		}
+
+		return matches[1];
+	}
 }
@@ -22,6 +22,8 @@ namespace Phalcon\Mvc\Router;
 use Phalcon\DiInterface;
 use Phalcon\Mvc\Router;
 use Phalcon\Annotations\Annotation;
+use Phalcon\Annotations\Reflection;
+use Phalcon\Annotations\AdapterInterface;
 use Phalcon\Mvc\Router\Exception;
 
 /**
@@ -56,6 +58,10 @@ class Annotations extends Router
 
 	protected _routePrefix;
 
+	protected _compiledKey;
+
+	protected _compiledResources;
+
 	/**
 	 * Adds a resource to the annotations handler
 	 * A resource is a class that contains routing annotations
@@ -80,122 +86,114 @@ class Annotations extends Router
 	}
 
 	/**
-	 * Produce the routing parameters from the rewrite information
+	 * Stores the routes read from the resources through the annotations
+	 * adapter, so they are built from ready-made definitions instead of
+	 * parsing the annotations on every request
+	 *
+	 *<code>
+	 * $router = new Annotations(false);
+	 *
+	 * $router->addResource("Robots", "/robots");
+	 *
+	 * $router->useCompiledResources("app-routes");
+	 *</code>
 	 */
-	public function handle(string! uri = null)
+	public function useCompiledResources(string! key = "router-annotations") -> <Annotations>
 	{
-		var realUri, annotationsService, handlers, controllerSuffix,
-			scope, prefix, dependencyInjector, handler, controllerName,
-			lowerControllerName, namespaceName, moduleName, sufixed, handlerAnnotations,
-			classAnnotations, annotations, annotation, methodAnnotations, method,
-			collection;
-
-		if !uri {
-			/**
-			 * If 'uri' isn't passed as parameter it reads $_GET["_url"]
-			 */
-			let realUri = this->getRewriteUri();
-		} else {
-			let realUri = uri;
-		}
+		let this->_compiledKey = key,
+			this->_compiledResources = null;
 
-		let dependencyInjector = <DiInterface> this->_dependencyInjector;
-		if typeof dependencyInjector != "object" {
-			throw new Exception("A dependency injection container is required to access the 'annotations' service");
-		}
+		return this;
+	}
 
-		let annotationsService = dependencyInjector->getShared("annotations");
+	/**
+	 * Returns the key used to store the compiled routes or null if they
+	 * are read from the annotations on every request
+	 */
+	public function getCompiledKey() -> string | null
+	{
+		return this->_compiledKey;
+	}
 
-		let handlers = this->_handlers;
+	/**
+	 * Reads the routes of every registered resource and returns their
+	 * definitions, the routes already added to the router are kept
+	 */
+	public function compileResources() -> array
+	{
+		var annotationsService, routes, resources, scope, route;
 
-		let controllerSuffix = this->_controllerSuffix;
+		let annotationsService = this->getAnnotationsService(),
+			routes = this->_routes,
+			resources = [];
 
-		for scope in handlers {
+		for scope in this->_handlers {
 
 			if typeof scope != "array" {
 				continue;
 			}
 
-			/**
-			 * A prefix (if any) must be in position 0
-			 */
-			let prefix = scope[0];
+			let this->_routes = [];
 
-			if !empty prefix && !starts_with(realUri, prefix) {
-				continue;
-			}
+			this->processResource(annotationsService, scope);
 
-			/**
-			 * The controller must be in position 1
-			 */
-			let handler = scope[1];
-
-			if memstr(handler, "\\") {
-
-				/**
-				 * Extract the real class name from the namespaced class
-				 * The lowercased class name is used as controller
-				 * Extract the namespace from the namespaced class
-				 */
-				let controllerName = get_class_ns(handler),
-					namespaceName = get_ns_class(handler);
-			} else {
-				let controllerName = handler;
-				fetch namespaceName, this->_defaultNamespace;
+			for route in this->_routes {
+				let resources[] = [
+					"prefix":      scope[0],
+					"pattern":     route->getPattern(),
+					"paths":       route->getPaths(),
+					"methods":     route->getHttpMethods(),
+					"converters":  route->getConverters(),
+					"beforeMatch": route->getBeforeMatch(),
+					"name":        route->getName()
+				];
 			}
+		}
 
-			let this->_routePrefix = null;
+		let this->_routes = routes,
+			this->_compiledRoutes = null;
 
-			/**
-			 * Check if the scope has a module associated
-			 */
-			fetch moduleName, scope[2];
+		return resources;
+	}
 
-			let sufixed = controllerName . controllerSuffix;
+	/**
+	 * Produce the routing parameters from the rewrite information
+	 */
+	public function handle(string! uri = null)
+	{
+		var realUri, annotationsService, scope, prefix;
 
+		if !uri {
 			/**
-			 * Add namespace to class if one is set
+			 * If 'uri' isn't passed as parameter it reads $_GET["_url"]
 			 */
-			if namespaceName !== null {
-				let sufixed = namespaceName . "\\" . sufixed;
-			}
+			let realUri = this->getRewriteUri();
+		} else {
+			let realUri = uri;
+		}
 
-			/**
-			 * Get the annotations from the class
-			 */
-			let handlerAnnotations = annotationsService->get(sufixed);
+		if this->_compiledKey !== null {
+			this->addCompiledResources(realUri);
+		} else {
 
-			if typeof handlerAnnotations != "object" {
-				continue;
-			}
+			let annotationsService = this->getAnnotationsService();
 
-			/**
-			 * Process class annotations
-			 */
-			let classAnnotations = handlerAnnotations->getClassAnnotations();
-			if typeof classAnnotations == "object" {
-				let annotations = classAnnotations->getAnnotations();
-				if typeof annotations == "array" {
-					for annotation in annotations {
-						this->processControllerAnnotation(controllerName, annotation);
-					}
+			for scope in this->_handlers {
+
+				if typeof scope != "array" {
+					continue;
 				}
-			}
 
-			/**
-			 * Process method annotations
-			 */
-			let methodAnnotations = handlerAnnotations->getMethodsAnnotations();
-			if typeof methodAnnotations == "array" {
-				let lowerControllerName = uncamelize(controllerName);
-
-				for method, collection in methodAnnotations {
-					if typeof collection == "object" {
-						for annotation in collection->getAnnotations() {
-							this->processActionAnnotation(moduleName, namespaceName, lowerControllerName, method, annotation);
-						}
-					}
+				/**
+				 * A prefix (if any) must be in position 0
+				 */
+				let prefix = scope[0];
+
+				if !empty prefix && !starts_with(realUri, prefix) {
+					continue;
 				}
+
+				this->processResource(annotationsService, scope);
 			}
 		}
 
@@ -392,4 +390,167 @@ class Annotations extends Router
 	{
 		return this->_handlers;
 	}
+
+	/**
+	 * Returns the 'annotations' service
+	 */
+	protected function getAnnotationsService() -> <AdapterInterface>
+	{
+		var dependencyInjector;
+
+		let dependencyInjector = <DiInterface> this->_dependencyInjector;
+		if typeof dependencyInjector != "object" {
+			throw new Exception("A dependency injection container is required to access the 'annotations' service");
+		}
+
+		return dependencyInjector->getShared("annotations");
+	}
+
+	/**
+	 * Adds the routes defined by the annotations of a resource
+	 */
+	protected function processResource(<AdapterInterface> annotationsService, array! scope) -> void
+	{
+		var handler, controllerName, lowerControllerName, namespaceName,
+			moduleName, sufixed, handlerAnnotations, classAnnotations,
+			annotations, annotation, methodAnnotations, method, collection;
+
+		/**
+		 * The controller must be in position 1
+		 */
+		let handler = scope[1];
+
+		if memstr(handler, "\\") {
+
+			/**
+			 * Extract the real class name from the namespaced class
+			 * The lowercased class name is used as controller
+			 * Extract the namespace from the namespaced class
+			 */
+			let controllerName = get_class_ns(handler),
+				namespaceName = get_ns_class(handler);
+		} else {
+			let controllerName = handler;
+			fetch namespaceName, this->_defaultNamespace;
+		}
+
+		let this->_routePrefix = null;
+
+		/**
+		 * Check if the scope has a module associated
+		 */
+		fetch moduleName, scope[2];
+
+		let sufixed = controllerName . this->_controllerSuffix;
+
+		/**
+		 * Add namespace to class if one is set
+		 */
+		if namespaceName !== null {
+			let sufixed = namespaceName . "\\" . sufixed;
+		}
+
+		/**
+		 * Get the annotations from the class
+		 */
+		let handlerAnnotations = annotationsService->get(sufixed);
+
+		if typeof handlerAnnotations != "object" {
+			return;
+		}
+
+		/**
+		 * Process class annotations
+		 */
+		let classAnnotations = handlerAnnotations->getClassAnnotations();
+		if typeof classAnnotations == "object" {
+			let annotations = classAnnotations->getAnnotations();
+			if typeof annotations == "array" {
+				for annotation in annotations {
+					this->processControllerAnnotation(controllerName, annotation);
+				}
+			}
+		}
+
+		/**
+		 * Process method annotations
+		 */
+		let methodAnnotations = handlerAnnotations->getMethodsAnnotations();
+		if typeof methodAnnotations == "array" {
+			let lowerControllerName = uncamelize(controllerName);
+
+			for method, collection in methodAnnotations {
+				if typeof collection == "object" {
+					for annotation in collection->getAnnotations() {
+						this->processActionAnnotation(moduleName, namespaceName, lowerControllerName, method, annotation);
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * Adds the compiled routes whose resource prefix matches the URI. The
+	 * definitions are read from the annotations adapter or compiled and
+	 * stored there if they are not found
+	 */
+	protected function addCompiledResources(string! uri) -> void
+	{
+		var resources, annotationsService, compiled, data, resource, prefix,
+			route, converters, param, convert, beforeMatch, name;
+
+		let resources = this->_compiledResources;
+
+		if typeof resources != "array" {
+
+			let annotationsService = this->getAnnotationsService(),
+				compiled = annotationsService->{"read"}(this->_compiledKey);
+
+			if typeof compiled == "object" {
+				let data = compiled->getReflectionData();
+				if typeof data == "array" {
+					fetch resources, data["routes"];
+				}
+			}
+
+			if typeof resources != "array" {
+				let resources = this->compileResources();
+
+				annotationsService->{"write"}(
+					this->_compiledKey,
+					new Reflection(["routes": resources])
+				);
+			}
+
+			let this->_compiledResources = resources;
+		}
+
+		for resource in resources {
+
+			let prefix = resource["prefix"];
+
+			if !empty prefix && !starts_with(uri, prefix) {
+				continue;
+			}
+
+			let route = this->add(resource["pattern"], resource["paths"], resource["methods"]);
+
+			let converters = resource["converters"];
+			if typeof converters == "array" {
+				for param, convert in converters {
+					route->convert(param, convert);
+				}
+			}
+
+			let beforeMatch = resource["beforeMatch"];
+			if beforeMatch !== null {
+				route->beforeMatch(beforeMatch);
+			}
+
+			let name = resource["name"];
+			if typeof name == "string" {
+				route->setName(name);
+			}
+		}
+	}
 }
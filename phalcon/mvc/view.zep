@@ -26,6 +26,7 @@ use Phalcon\Mvc\ViewInterface;
 use Phalcon\Cache\BackendInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Mvc\View\Engine\Php as PhpEngine;
+use Phalcon\Mvc\View\Engine\Volt as VoltEngine;
 
 /**
  * Phalcon\Mvc\View
@@ -147,6 +148,11 @@ class View extends Injectable implements ViewInterface
 
 	protected _disabled = false;
 
+	/**
+	 * Views and compiled templates found by compileAll()
+	 */
+	protected _manifest;
+
 	/**
 	 * Phalcon\Mvc\View constructor
 	 */
@@ -571,6 +577,10 @@ class View extends Injectable implements ViewInterface
 			}
 
 			let this->_engines = engines;
+
+			if typeof this->_manifest == "array" {
+				this->setEnginesManifest(engines);
+			}
 		}
 
 		return engines;
@@ -591,18 +601,27 @@ class View extends Injectable implements ViewInterface
 		int renderLevel, cacheLevel;
 		var key, lifetime, viewsDir, basePath, viewsDirPath,
 			viewOptions, cacheOptions, cachedView, viewParams, eventsManager,
-			extension, engine, viewEnginePath, viewEnginePaths;
+			extension, engine, viewEnginePath, viewEnginePaths, manifestViews,
+			viewEngines;
 
 		let notExists = true,
 			basePath = this->_basePath,
 			viewParams = this->_viewParams,
 			eventsManager = <ManagerInterface> this->_eventsManager,
-			viewEnginePaths = [];
+			viewEnginePaths = [],
+			manifestViews = null;
 
 		for viewsDir in this->getViewsDirs() {
 
 			if !this->_isAbsolutePath(viewPath) {
 				let viewsDirPath = basePath . viewsDir . viewPath;
+
+				/**
+				 * Views found by compileAll() are rendered without checking the filesystem
+				 */
+				if typeof this->_manifest == "array" {
+					let manifestViews = this->_manifest["views"];
+				}
 			} else {
 				let viewsDirPath = viewPath;
 			}
@@ -661,13 +680,27 @@ class View extends Injectable implements ViewInterface
 				}
 			}
 
+			if typeof manifestViews == "array" {
+				if fetch extension, manifestViews[viewsDirPath] {
+					if !fetch engine, engines[extension] {
+						throw new Exception("The view '" . viewsDirPath . "' of the manifest requires an engine for the extension: " . extension);
+					}
+
+					let viewEngines = [extension: engine];
+				} else {
+					let viewEngines = [];
+				}
+			} else {
+				let viewEngines = engines;
+			}
+
 			/**
 			 * Views are rendered in each engine
 			 */
-			for extension, engine in engines {
+			for extension, engine in viewEngines {
 
 				let viewEnginePath = viewsDirPath . extension;
-				if file_exists(viewEnginePath) {
+				if typeof manifestViews == "array" || file_exists(viewEnginePath) {
 
 					/**
 					 * Call beforeRenderView if there is an events manager available
@@ -734,7 +767,7 @@ class View extends Injectable implements ViewInterface
 	 */
 	public function exists(string! view) -> boolean
 	{
-		var basePath, viewsDir, engines, extension;
+		var basePath, viewsDir, engines, extension, manifestViews;
 
 		let basePath = this->_basePath,
 			engines = this->_registeredEngines;
@@ -744,6 +777,16 @@ class View extends Injectable implements ViewInterface
 				this->_registeredEngines = engines;
 		}
 
+		if typeof this->_manifest == "array" {
+			let manifestViews = this->_manifest["views"];
+			for viewsDir in this->getViewsDirs() {
+				if isset manifestViews[basePath . viewsDir . view] {
+					return true;
+				}
+			}
+			return false;
+		}
+
 		for viewsDir in this->getViewsDirs() {
 			for extension, _ in engines {
 				if file_exists(basePath . viewsDir . view . extension) {
@@ -954,7 +997,15 @@ class View extends Injectable implements ViewInterface
 			 */
 			if typeof cache == "object" {
 				if cache->isStarted() && cache->isFresh() {
-					cache->save();
+					/**
+					 * Stores the details used to expire the view early and
+					 * releases the lock taken by start()
+					 */
+					if cache instanceof \Phalcon\Cache\Backend {
+						cache->saveComputed();
+					} else {
+						cache->save();
+					}
 				} else {
 					cache->stop();
 				}
@@ -1416,6 +1467,138 @@ class View extends Injectable implements ViewInterface
 		return isset this->_viewParams[key];
 	}
 
+	/**
+	 * Finds every view in the views directories and compiles the Volt ones,
+	 * returning a manifest that setManifest() uses to render the views without
+	 * checking the filesystem. The manifest should be built when deploying and
+	 * stored, for instance, in a PHP file
+	 *
+	 *<code>
+	 * file_put_contents(
+	 *     "app/cache/views.php",
+	 *     "<?php return " . var_export($view->compileAll(), true) . ";"
+	 * );
+	 *</code>
+	 */
+	public function compileAll() -> array
+	{
+		var engines, basePath, viewsDir, directory, views, compiled, item, fileName,
+			extension, engine, viewPath, templatePath, compiler, positions, position, previous;
+
+		let engines = this->_loadTemplateEngines(),
+			basePath = this->_basePath,
+			views = [],
+			compiled = [],
+			positions = [];
+
+		for viewsDir in this->getViewsDirs() {
+
+			let directory = basePath . viewsDir;
+			if !is_dir(directory) {
+				continue;
+			}
+
+			for item in iterator(new \RecursiveIteratorIterator(new \RecursiveDirectoryIterator(directory, \FilesystemIterator::SKIP_DOTS))) {
+
+				if !item->isFile() {
+					continue;
+				}
+
+				let fileName = str_replace(DIRECTORY_SEPARATOR, "/", substr(item->getPathname(), strlen(directory))),
+					position = 0;
+
+				for extension, engine in engines {
+
+					if !ends_with(fileName, extension) {
+						let position++;
+						continue;
+					}
+
+					if typeof engine != "object" {
+						throw new Exception("Invalid template engine registration for extension: " . extension);
+					}
+
+					let viewPath = directory . substr(fileName, 0, -strlen(extension)),
+						templatePath = viewPath . extension;
+
+					/**
+					 * The first engine registered is the one used to render a view
+					 */
+					if !fetch previous, positions[viewPath] || position < previous {
+						let views[viewPath] = extension,
+							positions[viewPath] = position;
+					}
+
+					if engine instanceof VoltEngine {
+						let compiler = engine->getCompiler();
+						compiler->compile(templatePath);
+						let compiled[templatePath] = compiler->getCompiledTemplatePath();
+					}
+
+					break;
+				}
+			}
+		}
+
+		return [
+			"views":    views,
+			"compiled": compiled
+		];
+	}
+
+	/**
+	 * Sets the manifest returned by compileAll(), so views are rendered
+	 * without checking the filesystem. Views not found in the manifest
+	 * can't be rendered. Passing NULL checks the filesystem again
+	 */
+	public function setManifest(array manifest = null) -> <View>
+	{
+		if manifest !== null && (!isset manifest["views"] || !isset manifest["compiled"]) {
+			throw new Exception("The views manifest must have been built by compileAll()");
+		}
+
+		let this->_manifest = manifest;
+
+		if typeof this->_engines == "array" {
+			this->setEnginesManifest(this->_engines);
+		}
+
+		return this;
+	}
+
+	/**
+	 * Returns the manifest used to render the views
+	 */
+	public function getManifest() -> array | null
+	{
+		return this->_manifest;
+	}
+
+	/**
+	 * Passes the compiled templates of the manifest to the Volt engines,
+	 * every view of the manifest must have its engine registered
+	 */
+	protected function setEnginesManifest(array! engines) -> void
+	{
+		var engine, extension, viewPath, compiled = null;
+
+		if typeof this->_manifest == "array" {
+			let compiled = this->_manifest["compiled"];
+
+			for viewPath, extension in this->_manifest["views"] {
+				if !fetch engine, engines[extension] || typeof engine != "object" {
+					throw new Exception("The view '" . viewPath . "' of the manifest requires an engine for the extension: " . extension);
+				}
+			}
+		}
+
+		for engine in engines {
+			if engine instanceof VoltEngine {
+				engine->getCompiler()->setOption("manifest", compiled);
+			}
+		}
+	}
+
 	/**
 	 * Gets views directories
 	 */
@@ -2473,7 +2473,7 @@ class Compiler implements InjectionAwareInterface
 	{
 		var stat, compileAlways, prefix, compiledPath, compiledSeparator, blocksCode,
 			compiledExtension, compilation, options, realCompiledPath,
-			compiledTemplatePath, templateSepPath;
+			compiledTemplatePath, templateSepPath, manifest;
 
 		/**
 		 * Re-initialize some properties already initialized when the object is cloned
@@ -2497,6 +2497,16 @@ class Compiler implements InjectionAwareInterface
 		let options = this->_options;
 		if typeof options == "array" {
 
+			/**
+			 * Templates compiled ahead of time are used without checking the filesystem
+			 */
+			if !extendsMode && fetch manifest, options["manifest"] {
+				if typeof manifest == "array" && fetch compiledTemplatePath, manifest[templatePath] {
+					let this->_compiledTemplatePath = compiledTemplatePath;
+					return null;
+				}
+			}
+
 			/**
 			 * This makes that templates will be compiled always
 			 */
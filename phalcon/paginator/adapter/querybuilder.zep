@@ -45,9 +45,35 @@ use Phalcon\Db;
  *     ]
  * );
  *</code>
+ *
+ * Counting the records of large tables can be avoided or cached with the
+ * "count" option:
+ *
+ * - exact: counts the records on every page (default)
+ * - cached: stores the count in the "countService" cache service for
+ *   "countLifetime" seconds
+ * - none: only reports whether there is a next page
+ *
+ *<code>
+ * $paginator = new QueryBuilder(
+ *     [
+ *         "builder"       => $builder,
+ *         "limit"         => 20,
+ *         "page"          => 3,
+ *         "count"         => QueryBuilder::COUNT_CACHED,
+ *         "countLifetime" => 600,
+ *     ]
+ * );
+ *</code>
  */
 class QueryBuilder extends Adapter
 {
+	const COUNT_EXACT = "exact";
+
+	const COUNT_CACHED = "cached";
+
+	const COUNT_NONE = "none";
+
 	/**
 	 * Configuration of paginator by model
 	 */
@@ -123,19 +149,29 @@ class QueryBuilder extends Adapter
 	 */
 	public function getPaginate() -> <\stdClass>
 	{
-		var originalBuilder, builder, totalBuilder, totalPages,
-			limit, numberPage, number, query, page, before, items, totalQuery,
-			result, row, rowcount, next, sql, columns, db, hasHaving, hasGroup,
-			model, modelClass, dbService;
+		var originalBuilder, builder, totalBuilder, totalPages, limit,
+			numberPage, number, query, page, before, items, rowcount, next,
+			cursor, countStrategy;
+		boolean hasMore;
 
 		let originalBuilder = this->_builder;
-		let columns = this->_columns;
 
 		/**
 		 * We make a copy of the original builder to leave it as it is
 		 */
 		let builder = clone originalBuilder;
 
+		/**
+		 * Keyset pagination seeks from the last seen value of a column
+		 */
+		if fetch cursor, this->_config["cursor"] {
+			return this->getCursorPaginate(builder, cursor);
+		}
+
+		if !fetch countStrategy, this->_config["count"] {
+			let countStrategy = self::COUNT_EXACT;
+		}
+
 		/**
 		 * We make a copy of the original builder to count the total of records
 		 */
@@ -150,6 +186,47 @@ class QueryBuilder extends Adapter
 
 		let number = limit * (numberPage - 1);
 
+		if numberPage == 1 {
+			let before = 1;
+		} else {
+			let before = numberPage - 1;
+		}
+
+		/**
+		 * Without counting one more row is fetched to know if there is a
+		 * next page
+		 */
+		if countStrategy == self::COUNT_NONE {
+
+			if number < limit {
+				builder->limit(limit + 1);
+			} else {
+				builder->limit(limit + 1, number);
+			}
+
+			let items = builder->getQuery()->execute(),
+				hasMore = items->limitRows(limit);
+
+			if hasMore {
+				let next = numberPage + 1;
+			} else {
+				let next = numberPage;
+			}
+
+			let page = new \stdClass(),
+				page->items = items,
+				page->first = 1,
+				page->before = before,
+				page->current = numberPage,
+				page->last = null,
+				page->next = next,
+				page->total_pages = null,
+				page->total_items = null,
+				page->limit = limit;
+
+			return page;
+		}
+
 		/**
 		 * Set the limit clause avoiding negative offsets
 		 */
@@ -161,41 +238,77 @@ class QueryBuilder extends Adapter
 
 		let query = builder->getQuery();
 
-		if numberPage == 1 {
-			let before = 1;
-		} else {
-			let before = numberPage - 1;
-		}
-
 		/**
 		 * Execute the query an return the requested slice of data
 		 */
 		let items = query->execute();
 
+		if countStrategy == self::COUNT_CACHED {
+			let rowcount = this->getCachedTotalItems(totalBuilder);
+		} else {
+			let rowcount = this->getTotalItems(totalBuilder);
+		}
+
+		let totalPages = intval(ceil(rowcount / limit));
+
+		if numberPage < totalPages {
+			let next = numberPage + 1;
+		} else {
+			let next = totalPages;
+		}
+
+		let page = new \stdClass(),
+			page->items = items,
+			page->first = 1,
+			page->before = before,
+			page->current = numberPage,
+			page->last = totalPages,
+			page->next = next,
+			page->total_pages = totalPages,
+			page->total_items = rowcount,
+			page->limit = this->_limitRows;
+
+		return page;
+	}
+
+	/**
+	 * Counts the records returned by the builder
+	 */
+	protected function getTotalItems(<Builder> totalBuilder) -> int
+	{
+		var totalQuery, result, row, sql, columns, db, hasHaving, hasGroup,
+			model, modelClass, dbService, groups, groupColumn;
+
+		let columns = this->_columns;
+
 		let hasHaving = !empty totalBuilder->getHaving();
 
-        var groups = totalBuilder->getGroupBy();
+		let groups = totalBuilder->getGroupBy();
 
 		let hasGroup = !empty groups;
 
+		/**
+		 * The count doesn't return records to eager load relations on
+		 */
+		totalBuilder->with(null);
+
 		/**
 		 * Change the queried columns by a COUNT(*)
 		 */
 
 		if hasHaving && !hasGroup {
-            if empty columns {
-                throw new Exception("When having is set there should be columns option provided for which calculate row count");
-            }
-		    totalBuilder->columns(columns);
+			if empty columns {
+				throw new Exception("When having is set there should be columns option provided for which calculate row count");
+			}
+			totalBuilder->columns(columns);
 		} else {
-		    totalBuilder->columns("COUNT(*) [rowcount]");
+			totalBuilder->columns("COUNT(*) [rowcount]");
 		}
 
 		/**
 		 * Change 'COUNT()' parameters, when the query contains 'GROUP BY'
 		 */
 		if hasGroup {
-			var groupColumn;
 			if typeof groups == "array" {
 				let groupColumn = implode(", ", groups);
 			} else {
@@ -203,9 +316,9 @@ class QueryBuilder extends Adapter
 			}
 
 			if !hasHaving {
-			    totalBuilder->groupBy(null)->columns(["COUNT(DISTINCT ".groupColumn.") AS [rowcount]"]);
+				totalBuilder->groupBy(null)->columns(["COUNT(DISTINCT ".groupColumn.") AS [rowcount]"]);
 			} else {
-			    totalBuilder->columns(["DISTINCT ".groupColumn]);
+				totalBuilder->columns(["DISTINCT ".groupColumn]);
 			}
 		}
 
@@ -224,44 +337,167 @@ class QueryBuilder extends Adapter
 		 * If we have having perform native count on temp table
 		 */
 		if hasHaving {
-		    let sql = totalQuery->getSql(),
-		      modelClass = builder->_models;
+			let sql = totalQuery->getSql(),
+				modelClass = totalBuilder->getFrom();
 
 			if typeof modelClass == "array" {
-    			let modelClass = array_values(modelClass)[0];
+				let modelClass = array_values(modelClass)[0];
 			}
 
 			let model = new {modelClass}();
 			let dbService = model->getReadConnectionService();
 			let db = totalBuilder->getDI()->get(dbService);
-			let row = db->fetchOne("SELECT COUNT(*) as \"rowcount\" FROM (" .  sql["sql"] . ") as T1", Db::FETCH_ASSOC, sql["bind"]),
-		        rowcount = row ? intval(row["rowcount"]) : 0,
-		        totalPages = intval(ceil(rowcount / limit));
-		} else {
-            let result = totalQuery->execute(),
-                row = result->getFirst(),
-                rowcount = row ? intval(row->rowcount) : 0,
-                totalPages = intval(ceil(rowcount / limit));
+			let row = db->fetchOne("SELECT COUNT(*) as \"rowcount\" FROM (" .  sql["sql"] . ") as T1", Db::FETCH_ASSOC, sql["bind"]);
+
+			return row ? intval(row["rowcount"]) : 0;
 		}
 
-		if numberPage < totalPages {
-			let next = numberPage + 1;
+		let result = totalQuery->execute(),
+			row = result->getFirst();
+
+		return row ? intval(row->rowcount) : 0;
+	}
+
+	/**
+	 * Counts the records returned by the builder reusing the count stored in
+	 * the cache while it is not expired
+	 */
+	protected function getCachedTotalItems(<Builder> totalBuilder) -> int
+	{
+		var config, service, lifetime, key, dependencyInjector, cache,
+			rowcount;
+
+		let config = this->_config;
+
+		if !fetch service, config["countService"] {
+			let service = "modelsCache";
+		}
+
+		if !fetch lifetime, config["countLifetime"] {
+			let lifetime = 300;
+		}
+
+		if !fetch key, config["countKey"] {
+			let key = "_PHPC" . md5(totalBuilder->getPhql() . serialize(totalBuilder->getQuery()->getBindParams()));
+		}
+
+		let dependencyInjector = totalBuilder->getDI();
+		if typeof dependencyInjector != "object" {
+			throw new Exception("A dependency injection container is required to access the count cache");
+		}
+
+		let cache = dependencyInjector->getShared(service);
+		if typeof cache != "object" {
+			throw new Exception("The count cache service must be an object");
+		}
+
+		let rowcount = cache->get(key, lifetime);
+
+		if rowcount === null {
+			let rowcount = this->getTotalItems(totalBuilder);
+			cache->save(key, rowcount, lifetime);
+		}
+
+		return intval(rowcount);
+	}
+
+	/**
+	 * Returns a page of records that follow or precede the 'after' or
+	 * 'before' value of the cursor column, the records are ordered by that
+	 * column and nothing is counted
+	 *
+	 * <code>
+	 * $paginator = new QueryBuilder(
+	 *     [
+	 *         "builder" => $builder,
+	 *         "limit"   => 20,
+	 *         "cursor"  => "id",
+	 *         "after"   => $lastSeenId,
+	 *     ]
+	 * );
+	 *
+	 * $page = $paginator->getPaginate();
+	 *
+	 * // Value to pass as 'after' for the next page or null if it is the last
+	 * echo $page->next;
+	 * </code>
+	 */
+	protected function getCursorPaginate(<Builder> builder, string! cursor) -> <\stdClass>
+	{
+		var config, limit, after, before, items, attribute, first, last,
+			next, previous, page;
+		boolean hasMore;
+
+		let config = this->_config,
+			limit = this->_limitRows;
+
+		if !fetch after, config["after"] {
+			let after = null;
+		}
+
+		if !fetch before, config["before"] {
+			let before = null;
+		}
+
+		if before !== null {
+			builder->andWhere(cursor . " < :APCB:", ["APCB": before]);
+			builder->orderBy(cursor . " DESC");
 		} else {
-			let next = totalPages;
+			if after !== null {
+				builder->andWhere(cursor . " > :APCA:", ["APCA": after]);
+			}
+			builder->orderBy(cursor);
+		}
+
+		builder->limit(limit + 1);
+
+		/**
+		 * The rows before the cursor are fetched in descending order
+		 */
+		let items = builder->getQuery()->execute(),
+			hasMore = items->limitRows(limit, before !== null);
+
+		/**
+		 * The value of the cursor is read from the attribute of the rows
+		 */
+		let attribute = str_replace(["[", "]"], "", cursor);
+		if memstr(attribute, ".") {
+			let attribute = substr(strrchr(attribute, "."), 1);
+		}
+
+		let next = null,
+			previous = null;
+
+		if count(items) {
+			let first = items->getFirst(),
+				last = items->getLast();
+
+			if before !== null {
+				let next = last->{attribute};
+				if hasMore {
+					let previous = first->{attribute};
+				}
+			} else {
+				if hasMore {
+					let next = last->{attribute};
+				}
+				if after !== null {
+					let previous = first->{attribute};
+				}
+			}
 		}
 
 		let page = new \stdClass(),
 			page->items = items,
-			page->first = 1,
-			page->before = before,
-			page->current = numberPage,
-			page->last = totalPages,
+			page->first = null,
+			page->before = previous,
+			page->current = null,
+			page->last = null,
 			page->next = next,
-			page->total_pages = totalPages,
-			page->total_items = rowcount,
-			page->limit = this->_limitRows;
+			page->total_pages = null,
+			page->total_items = null,
+			page->limit = limit;
 
 		return page;
 	}
-
 }
@@ -0,0 +1,149 @@
+<?php
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2018 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+*/
+
+/**
+ * Compares Phalcon\Escaper::escapeJs/escapeCss with the UTF-32 path of a
+ * baseline build. Run it first with the baseline extension to save its
+ * timings and output, then with the current one to compare them:
+ *
+ * php -d extension=/path/to/baseline/phalcon.so tests/_ci/escaper_benchmark.php --save baseline.json
+ * php tests/_ci/escaper_benchmark.php --compare baseline.json
+ *
+ * The output is also checked against a PHP model of the UTF-32 path. An
+ * optional last argument sets the number of iterations (20000 by default)
+ */
+
+use Phalcon\Escaper;
+
+if (!extension_loaded('phalcon')) {
+    fwrite(STDERR, "The phalcon extension is not loaded" . PHP_EOL);
+    exit(1);
+}
+
+$mode       = isset($argv[1]) ? $argv[1] : null;
+$file       = isset($argv[2]) ? $argv[2] : null;
+$iterations = isset($argv[3]) ? (int) $argv[3] : 20000;
+
+if (($mode != '--save' && $mode != '--compare') || !$file) {
+    fwrite(STDERR, "Usage: php escaper_benchmark.php --save|--compare <file> [iterations]" . PHP_EOL);
+    exit(1);
+}
+
+/**
+ * Escapes a string the way zephir_escape_multi does after normalizing it to UTF-32
+ */
+function legacyEscape(Escaper $escaper, $value, $prefix, $suffix, $whitelist)
+{
+    $escaped = '';
+
+    foreach (unpack('N*', $escaper->normalizeEncoding($value)) as $code) {
+        if ($code < 256 && ctype_alnum(chr($code))) {
+            $escaped .= chr($code);
+        } elseif ($whitelist && $code < 128 && strpos(" /*+-\t\n^\$!?\\#}{)(][.,:;_|", chr($code)) !== false) {
+            $escaped .= chr($code);
+        } else {
+            $escaped .= $prefix . dechex($code) . $suffix;
+        }
+    }
+
+    return $escaped;
+}
+
+$samples = [
+    'ascii'    => str_repeat('PhalconFramework2018 ', 20),
+    'code'     => "var h2s = document.getElementsByTagName('H2'); for (var i=0; i<h2s.length; i++) {}",
+    'latin'    => str_repeat('Ça va très bien, merci. ', 10),
+    'cyrillic' => str_repeat('Привет, мир! ', 10),
+    'mixed'    => str_repeat('id-42 € 東京 ümlaut ', 10),
+];
+
+$methods = [
+    'escapeJs'  => ['\\x', '', true],
+    'escapeCss' => ['\\', ' ', false],
+];
+
+$escaper = new Escaper();
+$results = [];
+$failed  = false;
+
+foreach ($samples as $name => $sample) {
+    foreach ($methods as $method => $options) {
+        list($prefix, $suffix, $whitelist) = $options;
+
+        $escaped = $escaper->$method($sample);
+
+        if ($escaped !== legacyEscape($escaper, $sample, $prefix, $suffix, $whitelist)) {
+            fprintf(STDERR, "%s differs from the UTF-32 model for the '%s' sample%s", $method, $name, PHP_EOL);
+            $failed = true;
+        }
+
+        $start = microtime(true);
+        for ($i = 0; $i < $iterations; $i++) {
+            $escaper->$method($sample);
+        }
+
+        $results[$name . '/' . $method] = [
+            'time'    => (microtime(true) - $start) * 1000,
+            'escaped' => base64_encode($escaped),
+        ];
+    }
+}
+
+if ($mode == '--save') {
+    file_put_contents($file, json_encode(['iterations' => $iterations, 'results' => $results]));
+
+    foreach ($results as $key => $result) {
+        printf("%-20s %12.2f ms%s", $key, $result['time'], PHP_EOL);
+    }
+
+    exit($failed ? 1 : 0);
+}
+
+$baseline = json_decode(file_get_contents($file), true);
+
+if (!is_array($baseline) || $baseline['iterations'] != $iterations) {
+    fwrite(STDERR, "The baseline file is invalid or was saved with another number of iterations" . PHP_EOL);
+    exit(1);
+}
+
+printf("%-20s %14s %14s %8s%s", 'sample', 'baseline (ms)', 'current (ms)', 'speedup', PHP_EOL);
+
+foreach ($results as $key => $result) {
+    if (!isset($baseline['results'][$key])) {
+        fprintf(STDERR, "The baseline has no results for '%s'%s", $key, PHP_EOL);
+        $failed = true;
+        continue;
+    }
+
+    $previous = $baseline['results'][$key];
+
+    if ($previous['escaped'] !== $result['escaped']) {
+        fprintf(STDERR, "'%s' differs from the baseline output%s", $key, PHP_EOL);
+        $failed = true;
+    }
+
+    printf(
+        "%-20s %14.2f %14.2f %7.1fx%s",
+        $key,
+        $previous['time'],
+        $result['time'],
+        $previous['time'] / max($result['time'], 0.001),
+        PHP_EOL
+    );
+}
+
+exit($failed ? 1 : 0);
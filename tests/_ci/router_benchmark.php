@@ -0,0 +1,121 @@
+<?php
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2018 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+*/
+
+/**
+ * Compares Phalcon\Mvc\Router::handle with the compiled route table against
+ * the linear scan for 10, 100 and 1000 routes:
+ *
+ * php tests/_ci/router_benchmark.php
+ *
+ * Both routers must match the same routes. An optional argument sets the
+ * number of iterations (2000 by default)
+ */
+
+use Phalcon\Di\FactoryDefault;
+use Phalcon\Mvc\Router;
+
+if (!extension_loaded('phalcon')) {
+    fwrite(STDERR, "The phalcon extension is not loaded" . PHP_EOL);
+    exit(1);
+}
+
+$iterations = isset($argv[1]) ? (int) $argv[1] : 2000;
+
+if ($iterations < 1) {
+    fwrite(STDERR, "Usage: php router_benchmark.php [iterations]" . PHP_EOL);
+    exit(1);
+}
+
+/**
+ * Creates a router with the given number of routes per HTTP method
+ */
+function createRouter(FactoryDefault $di, $total, $compiled)
+{
+    $router = new Router(false);
+    $router->setDI($di);
+    $router->useCompiledRoutes($compiled);
+
+    for ($i = 0; $i < $total; $i++) {
+        $router->addGet('/section' . $i . '/{id:[0-9]+}', ['controller' => 'get' . $i, 'action' => 'show']);
+        $router->addPost('/section' . $i . '/{id:[0-9]+}', ['controller' => 'post' . $i, 'action' => 'save']);
+        $router->add('/section' . $i . '/about', ['controller' => 'static' . $i, 'action' => 'about']);
+    }
+
+    $router->add('/{slug:[a-z]+}/latest', ['controller' => 'slug', 'action' => 'latest']);
+
+    return $router;
+}
+
+$di     = new FactoryDefault();
+$failed = false;
+
+printf("%-8s %-6s %14s %14s %8s%s", 'routes', 'method', 'linear (ms)', 'compiled (ms)', 'speedup', PHP_EOL);
+
+foreach ([10, 100, 1000] as $total) {
+    $linear   = createRouter($di, $total, false);
+    $compiled = createRouter($di, $total, true);
+    $compiled->compileRoutes();
+
+    $uris = [
+        '/section0/12',
+        '/section' . intval($total / 2) . '/about',
+        '/section' . ($total - 1) . '/34',
+        '/news/latest',
+        '/missing/route',
+    ];
+
+    foreach (['GET', 'POST'] as $method) {
+        $_SERVER['REQUEST_METHOD'] = $method;
+
+        foreach ($uris as $uri) {
+            $linear->handle($uri);
+            $compiled->handle($uri);
+
+            if ($linear->wasMatched() !== $compiled->wasMatched() ||
+                $linear->getControllerName() !== $compiled->getControllerName() ||
+                $linear->getParams() !== $compiled->getParams()) {
+                fprintf(STDERR, "%s %s differs from the linear scan with %d routes%s", $method, $uri, $total, PHP_EOL);
+                $failed = true;
+            }
+        }
+
+        $times = [];
+
+        foreach (['linear' => $linear, 'compiled' => $compiled] as $name => $router) {
+            $start = microtime(true);
+            for ($i = 0; $i < $iterations; $i++) {
+                foreach ($uris as $uri) {
+                    $router->handle($uri);
+                }
+            }
+
+            $times[$name] = (microtime(true) - $start) * 1000;
+        }
+
+        printf(
+            "%-8d %-6s %14.2f %14.2f %7.1fx%s",
+            count($linear->getRoutes()),
+            $method,
+            $times['linear'],
+            $times['compiled'],
+            $times['linear'] / max($times['compiled'], 0.001),
+            PHP_EOL
+        );
+    }
+}
+
+exit($failed ? 1 : 0);
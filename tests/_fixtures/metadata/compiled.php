@@ -0,0 +1,83 @@
+<?php
+/**
+ * Fixture for Phalcon\Mvc\Model\MetaData\Compiled with the Robots model
+ *
+ * @copyright (c) 2011-2018 Phalcon Team
+ * @link      http://www.phalconphp.com
+ * @author    Phalcon Team <team@phalconphp.com>
+ * @package   Phalcon\Test\Models
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+return [
+    'meta-phalcon\\test\\models\\robots-robots' => [
+        0 => [
+            0 => 'id',
+            1 => 'name',
+            2 => 'type',
+            3 => 'year',
+            4 => 'datetime',
+            5 => 'deleted',
+            6 => 'text',
+        ],
+        1 => [
+            0 => 'id',
+        ],
+        2 => [
+            0 => 'name',
+            1 => 'type',
+            2 => 'year',
+            3 => 'datetime',
+            4 => 'deleted',
+            5 => 'text',
+        ],
+        3 => [
+            0 => 'id',
+            1 => 'name',
+            2 => 'type',
+            3 => 'year',
+            4 => 'datetime',
+            5 => 'text',
+        ],
+        4 => [
+            'id'       => 0,
+            'name'     => 2,
+            'type'     => 2,
+            'year'     => 0,
+            'datetime' => 4,
+            'deleted' => 4,
+            'text'     => 6,
+        ],
+        5 => [
+            'id'   => true,
+            'year' => true,
+        ],
+        8 => 'id',
+        9 => [
+            'id'       => 1,
+            'name'     => 2,
+            'type'     => 2,
+            'year'     => 1,
+            'datetime' => 2,
+            'deleted'  => 2,
+            'text'     => 2,
+        ],
+        10 => [],
+        11 => [],
+        12 => [
+            'type'    => 'mechanical',
+            'year'    => 1900,
+            'deleted' => null,
+        ],
+        13 => [],
+    ],
+    'map-phalcon\\test\\models\\robots' => [
+        0 => null,
+        1 => null,
+    ],
+];
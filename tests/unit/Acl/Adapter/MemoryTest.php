@@ -786,4 +786,64 @@ class MemoryTest extends UnitTest
         expect($acl->isAllowed($role, $role, 'update'))->true();
         expect($acl->isAllowed($resource, $resource, 'update'))->true();
     }
+
+    /**
+     * Tests compiled access lists take the same decisions as the access lists
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testCompiledAccessLists()
+    {
+        $this->specify(
+            "Compiled access lists don't take the same decisions",
+            function () {
+                $acl = new Memory();
+                $acl->setDefaultAction(Acl::DENY);
+
+                $acl->addRole('Guests');
+                $acl->addRole('Users', 'Guests');
+                $acl->addRole('Admins', 'Users');
+
+                $acl->addResource('Post', ['index', 'update', 'create', 'delete']);
+                $acl->addResource('Comment', ['index', 'create']);
+                $acl->addResource('Settings', ['index', 'update']);
+
+                $acl->allow('Guests', 'Post', 'index');
+                $acl->allow('*', 'Comment', 'index');
+                $acl->allow('Users', 'Comment', '*');
+                $acl->allow('Users', 'Post', ['update', 'create']);
+                $acl->deny('Users', 'Post', 'delete');
+                $acl->allow('Admins', '*', '*');
+                $acl->deny('Admins', 'Settings', 'update');
+
+                $checks = [];
+                foreach (['Guests', 'Users', 'Admins', 'Unknown'] as $role) {
+                    foreach (['Post', 'Comment', 'Settings', 'Unknown', '*'] as $resource) {
+                        foreach (['index', 'update', 'create', 'delete', 'unknown'] as $access) {
+                            $checks[] = [$role, $resource, $access, $acl->isAllowed($role, $resource, $access)];
+                        }
+                    }
+                }
+
+                expect($acl->isCompiled())->false();
+                expect($acl->compile()->isCompiled())->true();
+
+                $loaded = new Memory();
+                $loaded->loadCompiled($acl->exportCompiled());
+
+                foreach ($checks as $check) {
+                    list($role, $resource, $access, $allowed) = $check;
+
+                    expect($acl->isAllowed($role, $resource, $access))->equals($allowed);
+                    expect($loaded->isAllowed($role, $resource, $access))->equals($allowed);
+                }
+
+                $acl->allow('Guests', 'Post', 'create');
+
+                expect($acl->isCompiled())->false();
+                expect($acl->isAllowed('Guests', 'Post', 'create'))->true();
+            }
+        );
+    }
 }
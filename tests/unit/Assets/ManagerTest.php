@@ -649,4 +649,53 @@ class ManagerTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests building the collections to a manifest
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testBuildManifest()
+    {
+        $this->specify(
+            "The manifest built does not produce the correct result",
+            function () {
+                $I        = $this->tester;
+                $manifest = PATH_OUTPUT . 'tests/assets/manifest.php';
+                $content  = file_get_contents(PATH_DATA . 'assets/jquery.js') . ";\n";
+                $hash     = substr(md5($content), 0, 16);
+
+                $assets = new Manager();
+                $assets->useImplicitOutput(false);
+                $assets->collection('js')
+                    ->addJs(PATH_DATA . 'assets/jquery.js')
+                    ->addJs('//phalconphp.com/js/remote.js', false)
+                    ->join(true)
+                    ->setTargetPath(PATH_OUTPUT . 'tests/assets/bundle.js')
+                    ->setTargetUri('production/bundle.js');
+
+                $assets->build($manifest, ['gz']);
+
+                $I->seeFileFound(PATH_OUTPUT . "tests/assets/bundle.{$hash}.js");
+                $I->seeFileFound(PATH_OUTPUT . "tests/assets/bundle.{$hash}.js.gz");
+                $I->seeFileFound($manifest);
+
+                $expected = '<script type="text/javascript" src="/production/bundle.' . $hash . '.js"></script>' . PHP_EOL .
+                    '<script type="text/javascript" src="//phalconphp.com/js/remote.js"></script>' . PHP_EOL;
+
+                expect($assets->outputJs())->equals($expected);
+
+                $assets = new Manager();
+                $assets->useImplicitOutput(false);
+                $assets->setManifest(require $manifest);
+
+                expect($assets->outputJs())->equals($expected);
+
+                $I->deleteFile(PATH_OUTPUT . "tests/assets/bundle.{$hash}.js");
+                $I->deleteFile(PATH_OUTPUT . "tests/assets/bundle.{$hash}.js.gz");
+                $I->deleteFile($manifest);
+            }
+        );
+    }
 }
@@ -256,4 +256,28 @@ class ApcuCest
 
         $I->assertEquals($keys, ['app-datadata-key-1', 'app-datadata-key-2']);
     }
+
+    public function multiple(UnitTester $I)
+    {
+        $I->wantTo('Use several keys at once by using APCu as cache backend');
+
+        $data = [uniqid(), gethostname(), microtime()];
+
+        $cache = new Apcu(new Data(['lifetime' => 20]), ['prefix' => 'app-']);
+
+        $I->assertTrue($cache->saveMultiple(['data-1' => $data, 'data-2' => 'value']));
+        $I->seeInApc('_PHCA' . 'app-data-1', serialize($data));
+        $I->seeInApc('_PHCA' . 'app-data-2', serialize('value'));
+
+        $I->assertEquals(
+            ['data-2' => 'value', 'data-3' => null, 'data-1' => $data],
+            $cache->getMultiple(['data-2', 'data-3', 'data-1'])
+        );
+
+        $I->assertTrue($cache->deleteMultiple(['data-1', 'data-2']));
+        $I->dontSeeInApc('_PHCA' . 'app-data-1');
+        $I->dontSeeInApc('_PHCA' . 'app-data-2');
+
+        $I->assertFalse($cache->deleteMultiple(['data-1']));
+    }
 }
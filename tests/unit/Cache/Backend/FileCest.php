@@ -63,6 +63,117 @@ class FileCest
         $I->deleteFile('start-keyname');
     }
 
+    public function shardedDirectories(UnitTester $I)
+    {
+        $I->wantTo("Use hashed subdirectories by using file cache as backend");
+
+        $cache = new File(
+            new Data(['lifetime' => 20]),
+            [
+                'cacheDir'    => PATH_CACHE,
+                'prefix'      => 'sharded-',
+                'shardLevels' => 2,
+            ]
+        );
+
+        $hash = md5('sharded-robots');
+
+        $I->assertTrue($cache->save('robots', ['name' => 'Astro Boy']));
+        $I->assertTrue($cache->save('robots-count', 10));
+        $I->assertTrue($cache->save('products', 'list'));
+
+        $I->amInPath(PATH_CACHE . substr($hash, 0, 2) . '/' . substr($hash, 2, 2));
+        $I->seeFileFound('sharded-robots');
+        $I->dontSeeFileFound('sharded-robots', PATH_CACHE);
+
+        $I->assertEquals(['name' => 'Astro Boy'], $cache->get('robots'));
+
+        $keys = $cache->queryKeys('robots');
+        sort($keys);
+        $I->assertEquals(['sharded-robots', 'sharded-robots-count'], $keys);
+
+        $I->assertEquals(12, $cache->increment('robots-count', 2));
+        $I->assertEquals(11, $cache->decrement('robots-count'));
+        $I->assertEquals(11, $cache->get('robots-count'));
+
+        $I->assertTrue($cache->delete('products'));
+        $I->assertEquals(['sharded-robots', 'sharded-robots-count'], $cache->queryKeys());
+
+        $I->assertTrue($cache->flush());
+        $I->assertEquals([], $cache->queryKeys());
+        $I->assertNull($cache->get('robots'));
+    }
+
+    public function shardedIndex(UnitTester $I)
+    {
+        $I->wantTo("Keep the index of a sharded file cache compact without pruning it on every delete");
+
+        $cache = new File(
+            new Data(['lifetime' => 20]),
+            [
+                'cacheDir'    => PATH_CACHE,
+                'prefix'      => 'index-',
+                'shardLevels' => 1,
+            ]
+        );
+
+        $I->assertTrue($cache->save('robots', 'list'));
+
+        for ($i = 0; $i < 10; $i++) {
+            $I->assertTrue($cache->save('products', $i));
+            $I->assertTrue($cache->delete('products'));
+        }
+
+        // Deleting a key leaves it in the index, it's skipped by queryKeys()
+        $I->assertEquals(['index-robots'], $cache->queryKeys());
+        $I->assertCount(11, file(PATH_CACHE . '.phcindex', FILE_IGNORE_NEW_LINES | FILE_SKIP_EMPTY_LINES));
+
+        // Repeated lines are removed once they are most of the index
+        file_put_contents(PATH_CACHE . '.phcindex', str_repeat('index-robots' . PHP_EOL, 100), FILE_APPEND);
+
+        $I->assertEquals(['index-robots'], $cache->queryKeys());
+        $I->assertEquals(['index-robots'], file(PATH_CACHE . '.phcindex', FILE_IGNORE_NEW_LINES | FILE_SKIP_EMPTY_LINES));
+
+        // Deleted keys are removed once they are most of the index
+        for ($i = 0; $i < 100; $i++) {
+            $I->assertTrue($cache->save('product-' . $i, $i));
+            $I->assertTrue($cache->delete('product-' . $i));
+        }
+
+        $I->assertEquals(['index-robots'], $cache->queryKeys());
+        $I->assertEquals(['index-robots'], file(PATH_CACHE . '.phcindex', FILE_IGNORE_NEW_LINES | FILE_SKIP_EMPTY_LINES));
+
+        $I->assertTrue($cache->flush());
+        $I->assertEquals([], $cache->queryKeys());
+    }
+
+    public function counterReplacesFile(UnitTester $I)
+    {
+        $I->wantTo("Update counters of a file cache without rewriting the file in place");
+
+        $cache = new File(new Data(['lifetime' => 20]), ['cacheDir' => PATH_CACHE, 'prefix' => 'counter-']);
+
+        $I->assertTrue($cache->save('visits', 10));
+
+        clearstatcache();
+        $inode = fileinode(PATH_CACHE . 'counter-visits');
+
+        $I->assertEquals(11, $cache->increment('visits'));
+        $I->assertEquals(11, $cache->get('visits'));
+
+        // The new value is published with a rename, readers never see an empty file
+        clearstatcache();
+        $I->assertNotEquals($inode, fileinode(PATH_CACHE . 'counter-visits'));
+
+        // The lock file is not a cached key
+        $I->amInPath(PATH_CACHE);
+        $I->seeFileFound('.phclock');
+        $I->assertEquals(['counter-visits'], $cache->queryKeys('visits'));
+
+        $I->assertNull($cache->increment('missing'));
+        $I->assertTrue($cache->delete('visits'));
+    }
+
     public function outputFrontend(UnitTester $I)
     {
         $I->wantTo("Use File cache with Output frontend");
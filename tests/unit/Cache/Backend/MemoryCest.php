@@ -5,6 +5,8 @@ namespace Phalcon\Test\Unit\Cache\Backend;
 use UnitTester;
 use Phalcon\Cache\Frontend\Data;
 use Phalcon\Cache\Frontend\None;
+use Phalcon\Cache\Frontend\Output;
+use Phalcon\Cache\Multiple;
 use Phalcon\Cache\Backend\Memory;
 
 /**
@@ -163,4 +165,152 @@ class MemoryCest
         $I->assertEquals($s1, $s3);
         $I->assertEquals($s1, $string);
     }
+
+    public function multiple(UnitTester $I)
+    {
+        $I->wantTo('Use several keys at once by using Memory as cache backend');
+
+        $data = [uniqid(), gethostname(), microtime()];
+
+        $cache = new Memory(new Data(['lifetime' => 20]));
+
+        $I->assertTrue($cache->saveMultiple(['data-1' => $data, 'data-2' => 2018]));
+        $I->assertEquals(
+            ['data-1' => serialize($data), 'data-2' => 2018],
+            $I->getProtectedProperty($cache, '_data')
+        );
+
+        $I->assertEquals(
+            ['data-2' => 2018, 'data-3' => null, 'data-1' => $data],
+            $cache->getMultiple(['data-2', 'data-3', 'data-1'])
+        );
+
+        $I->assertTrue($cache->deleteMultiple(['data-1', 'data-2']));
+        $I->assertFalse($cache->deleteMultiple(['data-1']));
+        $I->assertEquals(['data-1' => null], $cache->getMultiple(['data-1']));
+    }
+
+    public function multipleBackFill(UnitTester $I)
+    {
+        $I->wantTo('Back-fill the faster backends by using Memory as cache backend');
+
+        $fast = new Memory(new Data(['lifetime' => 20]));
+        $slow = new Memory(new Data(['lifetime' => 20]));
+
+        $slow->saveMultiple(['data-1' => 'first', 'data-2' => 'second']);
+        $fast->save('data-2', 'cached');
+
+        $cache = new Multiple([$fast, $slow]);
+
+        $I->assertEquals(
+            ['data-1' => 'first', 'data-2' => 'cached', 'data-3' => null],
+            $cache->getMultiple(['data-1', 'data-2', 'data-3'])
+        );
+
+        $I->assertEquals('first', $fast->get('data-1'));
+        $I->assertEquals('cached', $fast->get('data-2'));
+
+        $cache->deleteMultiple(['data-1', 'data-2']);
+
+        $I->assertNull($fast->get('data-1'));
+        $I->assertNull($slow->get('data-2'));
+    }
+
+    public function getOrCompute(UnitTester $I)
+    {
+        $I->wantTo('Compute expired values once by using Memory as cache backend');
+
+        $cache = new Memory(new Data(['lifetime' => 20]), ['lockLifetime' => 10]);
+        $calls = 0;
+
+        $compute = function ($key) use (&$calls) {
+            $calls++;
+            return $key . '-' . $calls;
+        };
+
+        $I->assertEquals('robots-1', $cache->getOrCompute('robots', $compute, 20));
+        $I->assertEquals('robots-1', $cache->getOrCompute('robots', $compute, 20));
+        $I->assertEquals(1, $calls);
+
+        /**
+         * Expire the value while another process holds the lock
+         */
+        $cache->save('robots_PHMT', (microtime(true) - 1) . '|0.01');
+        $cache->save('robots_PHLK', 'lock');
+
+        $I->assertEquals('robots-1', $cache->getOrCompute('robots', $compute, 20));
+        $I->assertEquals(1, $calls);
+
+        $cache->delete('robots_PHLK');
+
+        $I->assertEquals('robots-2', $cache->getOrCompute('robots', $compute, 20));
+        $I->assertEquals('robots-2', $cache->getOrCompute('robots', $compute, 20));
+        $I->assertEquals(2, $calls);
+        $I->assertFalse($cache->exists('robots_PHLK'));
+    }
+
+    public function getOrComputeMissing(UnitTester $I)
+    {
+        $I->wantTo('Wait for the lock on missing values by using Memory as cache backend');
+
+        $cache = new Memory(new Data(['lifetime' => 20]), ['lockLifetime' => 1]);
+        $calls = 0;
+
+        $compute = function ($key) use (&$calls) {
+            $calls++;
+            return $key . '-' . $calls;
+        };
+
+        /**
+         * Another process computes the value, it's computed anyway once the
+         * lock expires
+         */
+        $cache->save('robots_PHLK', 'lock');
+
+        $start = microtime(true);
+        $I->assertEquals('robots-1', $cache->getOrCompute('robots', $compute, 20));
+        $I->assertGreaterThanOrEqual(1, microtime(true) - $start);
+        $I->assertTrue($cache->exists('robots_PHLK'));
+
+        $cache->delete('robots_PHLK');
+
+        /**
+         * The lock is released when the computation fails
+         */
+        try {
+            $cache->getOrCompute('parts', function () {
+                throw new \RuntimeException('failed');
+            }, 20);
+        } catch (\RuntimeException $e) {
+        }
+
+        $I->assertFalse($cache->exists('parts_PHLK'));
+        $I->assertNull($cache->get('parts'));
+    }
+
+    public function startLocked(UnitTester $I)
+    {
+        $I->wantTo('Lock the buffered contents by using Memory as cache backend');
+
+        $cache = new Memory(new Output(['lifetime' => 20]), ['lockLifetime' => 10]);
+
+        ob_start();
+
+        $I->assertNull($cache->start('view'));
+        $I->assertTrue($cache->exists('view_PHLK'));
+
+        echo 'rendered';
+        $I->assertTrue($cache->saveComputed());
+        ob_end_clean();
+
+        $I->assertFalse($cache->exists('view_PHLK'));
+        $I->assertEquals('rendered', $cache->start('view'));
+
+        $cache->stop();
+
+        $I->assertNull($cache->start('other'));
+        $cache->stop();
+
+        $I->assertFalse($cache->exists('other_PHLK'));
+    }
 }
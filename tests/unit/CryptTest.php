@@ -292,4 +292,131 @@ class CryptTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests encryption with an authenticated cipher
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldEncryptWithAuthenticatedCipher()
+    {
+        if (version_compare(PHP_VERSION, '7.1.0', '<')) {
+            $this->markTestSkipped('Authenticated ciphers require PHP 7.1');
+        }
+
+        $this->specify(
+            'Crypt does not authenticate the data with an AEAD cipher',
+            function () {
+                $crypt = new Crypt('aes-256-gcm');
+                $crypt->setKey('secret');
+
+                $encrypted = $crypt->encrypt('le text');
+
+                expect($crypt->decrypt($encrypted))->equals('le text');
+
+                try {
+                    $crypt->decrypt(substr($encrypted, 0, -1) . chr(ord(substr($encrypted, -1)) ^ 1));
+                    $mismatch = false;
+                } catch (Mismatch $e) {
+                    $mismatch = true;
+                }
+
+                expect($mismatch)->true();
+            }
+        );
+    }
+
+    /**
+     * Tests encryption with chacha20-poly1305
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldEncryptWithChacha20Poly1305()
+    {
+        if (!in_array('chacha20-poly1305', openssl_get_cipher_methods(true))) {
+            $this->markTestSkipped('The chacha20-poly1305 cipher is not available');
+        }
+
+        $this->specify(
+            'Crypt does not authenticate the data with chacha20-poly1305 from PHP 8.2',
+            function () {
+                $crypt = new Crypt('chacha20-poly1305');
+                $crypt->setKey('secret');
+
+                $encrypted = $crypt->encrypt('le text');
+
+                expect($crypt->decrypt($encrypted))->equals('le text');
+
+                try {
+                    $crypt->decrypt(substr($encrypted, 0, -1) . chr(ord(substr($encrypted, -1)) ^ 1));
+                    $mismatch = false;
+                } catch (Mismatch $e) {
+                    $mismatch = true;
+                }
+
+                // Older versions don't return the tag, the data isn't authenticated
+                expect($mismatch)->equals(PHP_VERSION_ID >= 80200);
+            }
+        );
+    }
+
+    /**
+     * Tests refusing AEAD ciphers before PHP 7.1
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldNotAcceptAuthenticatedCipherBeforePhp71()
+    {
+        if (version_compare(PHP_VERSION, '7.1.0', '>=')) {
+            $this->markTestSkipped('Authenticated ciphers are supported since PHP 7.1');
+        }
+
+        $this->specify(
+            'Crypt accepts an AEAD cipher without support for the tag',
+            function () {
+                $crypt = new Crypt();
+                $crypt->setCipher('aes-256-gcm');
+            },
+            [
+                'throws' => [
+                    Exception::class,
+                    'The cipher algorithm "aes-256-gcm" requires PHP 7.1 or greater',
+                ],
+            ]
+        );
+    }
+
+    /**
+     * Tests encrypting and decrypting many texts
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldEncryptMany()
+    {
+        $this->specify(
+            'Crypt does not encrypt many texts as expected',
+            function () {
+                $crypt = new Crypt();
+                $crypt->setKey('secret');
+
+                $texts = [
+                    'name'  => 'le text',
+                    'email' => 'team@phalconphp.com',
+                ];
+
+                $encrypted = $crypt->encryptMany($texts);
+
+                expect(array_keys($encrypted))->equals(['name', 'email']);
+                expect($crypt->decryptMany($encrypted))->equals($texts);
+            }
+        );
+    }
 }
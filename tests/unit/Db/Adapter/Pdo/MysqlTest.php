@@ -3,6 +3,7 @@
 namespace Phalcon\Test\Unit\Db\Adapter\Pdo;
 
 use Phalcon\Db;
+use Phalcon\Db\Column;
 use Phalcon\Db\Reference;
 use Phalcon\Test\Module\UnitTest;
 use Phalcon\Db\Adapter\Pdo\Mysql;
@@ -235,4 +236,169 @@ class MysqlTest extends UnitTest
             ]
         );
     }
+
+    /**
+     * Tests Mysql::query by reusing prepared statements
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldReusePreparedStatements()
+    {
+        $this->specify(
+            'The prepared statements are not reused as expected',
+            function () {
+                $this->connection->setStatementCacheSize(2);
+
+                $sql = 'SELECT id, name FROM robots WHERE id = ?';
+
+                $first = $this->connection->fetchOne($sql, Db::FETCH_ASSOC, [1]);
+                $second = $this->connection->fetchOne($sql, Db::FETCH_ASSOC, [2]);
+
+                expect($first['id'])->equals(1);
+                expect($second['id'])->equals(2);
+
+                $this->connection->fetchOne('SELECT id FROM robots WHERE id > ?', Db::FETCH_ASSOC, [1]);
+                $this->connection->fetchOne('SELECT id FROM robots WHERE id < ?', Db::FETCH_ASSOC, [3]);
+
+                expect($this->connection->getStatementCacheStats())->equals([
+                    'size'     => 2,
+                    'capacity' => 2,
+                    'hits'     => 1,
+                    'misses'   => 3,
+                ]);
+
+                $this->connection->connect();
+                expect($this->connection->getStatementCacheStats()['size'])->equals(0);
+            }
+        );
+    }
+
+    /**
+     * Tests Mysql::query with nested iterations of the same cached statement
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldNotReuseStatementsInUse()
+    {
+        $this->specify(
+            'The cached statements are reused while a result still reads from them',
+            function () {
+                $this->connection->setStatementCacheSize(4);
+
+                $sql = 'SELECT id FROM tipo_documento WHERE id <= ? ORDER BY id';
+
+                $outer = $this->connection->query($sql, [40]);
+                $outer->setFetchMode(Db::FETCH_ASSOC);
+
+                $ids = [];
+                while ($row = $outer->fetch()) {
+                    $ids[] = (int) $row['id'];
+
+                    $inner = $this->connection->query($sql, [35]);
+                    expect($inner->fetchAll())->count(35);
+                }
+
+                expect($ids)->equals(range(1, 40));
+
+                // Once the outer result is consumed the statement is reused again
+                $stats = $this->connection->getStatementCacheStats();
+                $this->connection->query($sql, [1])->fetchAll();
+                expect($this->connection->getStatementCacheStats()['hits'])->equals($stats['hits'] + 1);
+
+                $this->connection->setStatementCacheSize(0);
+                $this->connection->clearStatementCache();
+            }
+        );
+    }
+
+    /**
+     * Tests reading a result once its statement is given back to the connection
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldReadReleasedResults()
+    {
+        $this->specify(
+            'The result reads the statement given back to the connection',
+            function () {
+                $this->connection->setStatementCacheSize(4);
+
+                $result = $this->connection->query('SELECT id FROM robots WHERE id <= ? ORDER BY id', [3]);
+                expect($result->fetchAll())->count(3);
+
+                // The statement is reused by another query
+                $this->connection->query('SELECT id FROM robots WHERE id <= ? ORDER BY id', [1])->fetchAll();
+
+                expect($result->numRows())->equals(3);
+
+                try {
+                    $result->getInternalResult();
+                    $released = false;
+                } catch (\Phalcon\Db\Exception $e) {
+                    $released = true;
+                }
+
+                expect($released)->true();
+
+                expect($result->setFetchMode(Db::FETCH_NUM))->true();
+                expect($result->execute())->true();
+                expect($result->fetch())->equals([1]);
+                expect($result->getInternalResult())->isInstanceOf(\PDOStatement::class);
+
+                $this->connection->setStatementCacheSize(0);
+                $this->connection->clearStatementCache();
+            }
+        );
+    }
+
+    /**
+     * Tests Mysql::insertMultiple and Mysql::upsert
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testInsertMultipleAndUpsert()
+    {
+        $this->specify(
+            'The rows are not inserted or upserted as expected',
+            function () {
+                $this->connection->delete('m2m_parts');
+
+                $success = $this->connection->insertMultiple(
+                    'm2m_parts',
+                    [
+                        [1, 'Head'],
+                        [2, 'Body'],
+                        [3, 'Arms'],
+                    ],
+                    ['id', 'name'],
+                    [Column::BIND_PARAM_INT, Column::BIND_PARAM_STR],
+                    2
+                );
+
+                expect($success)->true();
+                expect($this->connection->fetchColumn('SELECT COUNT(*) FROM m2m_parts'))->equals(3);
+
+                $success = $this->connection->upsert(
+                    'm2m_parts',
+                    [2, 'Torso'],
+                    ['id', 'name'],
+                    ['name'],
+                    ['id']
+                );
+
+                expect($success)->true();
+                expect($this->connection->fetchColumn('SELECT COUNT(*) FROM m2m_parts'))->equals(3);
+                expect($this->connection->fetchColumn('SELECT name FROM m2m_parts WHERE id = 2'))->equals('Torso');
+
+                $this->connection->delete('m2m_parts');
+            }
+        );
+    }
 }
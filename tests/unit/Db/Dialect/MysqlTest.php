@@ -433,6 +433,61 @@ class MysqlTest extends UnitTest
         );
     }
 
+    /**
+     * Tests Mysql::describeSchemaColumns
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function describeSchemaColumns()
+    {
+        $this->specify(
+            'The SQL generated to describe the columns of a schema is incorrect',
+            function ($schema, $expected) {
+                $dialect = new Mysql();
+
+                expect($dialect->describeSchemaColumns($schema))->equals($expected);
+            },
+            [
+                'examples' => [
+                    [
+                        null,
+                        'SELECT `COLUMN_NAME`, `COLUMN_TYPE`, `IS_NULLABLE`, `COLUMN_KEY`, `COLUMN_DEFAULT`, `EXTRA`, `TABLE_NAME` ' .
+                        'FROM `INFORMATION_SCHEMA`.`COLUMNS` WHERE `TABLE_SCHEMA` = DATABASE() ORDER BY `TABLE_NAME`, `ORDINAL_POSITION`'
+                    ],
+                    [
+                        'schema',
+                        'SELECT `COLUMN_NAME`, `COLUMN_TYPE`, `IS_NULLABLE`, `COLUMN_KEY`, `COLUMN_DEFAULT`, `EXTRA`, `TABLE_NAME` ' .
+                        'FROM `INFORMATION_SCHEMA`.`COLUMNS` WHERE `TABLE_SCHEMA` = \'schema\' ORDER BY `TABLE_NAME`, `ORDINAL_POSITION`'
+                    ],
+                ]
+            ]
+        );
+    }
+
+    /**
+     * Tests Mysql::upsert
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function upsert()
+    {
+        $this->specify(
+            'The SQL generated to upsert a row is incorrect',
+            function () {
+                $dialect = new Mysql();
+
+                expect($dialect->upsert('INSERT INTO `robots` (`id`, `name`, `year`) VALUES (?, ?, ?)', ['name', 'year']))->equals(
+                    'INSERT INTO `robots` (`id`, `name`, `year`) VALUES (?, ?, ?) ' .
+                    'ON DUPLICATE KEY UPDATE `name` = VALUES(`name`), `year` = VALUES(`year`)'
+                );
+            }
+        );
+    }
+
     /**
      * Tests Mysql::createSavepoint
      *
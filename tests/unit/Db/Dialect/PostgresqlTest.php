@@ -414,6 +414,31 @@ class PostgresqlTest extends UnitTest
         );
     }
 
+    /**
+     * Tests Postgresql::upsert
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function upsert()
+    {
+        $this->specify(
+            'The SQL generated to upsert a row is incorrect',
+            function () {
+                $dialect = new Postgresql();
+
+                expect($dialect->upsert('INSERT INTO "robots" ("id", "name") VALUES (?, ?)', ['name'], ['id']))->equals(
+                    'INSERT INTO "robots" ("id", "name") VALUES (?, ?) ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"'
+                );
+
+                expect($dialect->upsert('INSERT INTO "robots" ("id", "name") VALUES (?, ?)', [], ['id']))->equals(
+                    'INSERT INTO "robots" ("id", "name") VALUES (?, ?) ON CONFLICT ("id") DO NOTHING'
+                );
+            }
+        );
+    }
+
     /**
      * Tests Postgresql::createSavepoint
      *
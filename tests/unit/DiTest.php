@@ -580,4 +580,81 @@ class DiTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests resolving services from compiled definitions.
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testCompiledServices()
+    {
+        $this->specify(
+            'Di does not resolve compiled services properly',
+            function () {
+                $response = new Response();
+
+                $this->phDi->loadFromPhp(PATH_DATA . 'di/services.php');
+                $this->phDi->set('response', $response);
+                $this->phDi->set('request', Request::class);
+                $this->phDi->set(
+                    'complexSetters',
+                    [
+                        'className' => 'InjectableComponent',
+                        'calls' => [
+                            [
+                                'method' => 'setResponse',
+                                'arguments' => [
+                                    [
+                                        'type' => 'service',
+                                        'name' => 'response',
+                                    ]
+                                ]
+                            ],
+                        ]
+                    ]
+                );
+
+                expect($this->phDi->compile()->isCompiled())->true();
+                expect($this->phDi->getService('component')->isCompiled())->true();
+                expect($this->phDi->getService('request')->isCompiled())->true();
+                expect($this->phDi->getService('response')->isCompiled())->false();
+
+                $this->phDi->set(
+                    'simpleProperties',
+                    [
+                        'className' => 'InjectableComponent',
+                        'properties' => [
+                            [
+                                'name' => 'response',
+                                'value' => [
+                                    'type' => 'parameter',
+                                    'value' => 'response'
+                                ]
+                            ],
+                        ]
+                    ]
+                );
+
+                expect($this->phDi->getService('simpleProperties')->isCompiled())->true();
+
+                $this->phDi->collectStats(true);
+
+                expect($this->phDi->get('request'))->isInstanceOf(Request::class);
+                expect($this->phDi->get('complexSetters')->getResponse())->equals($response);
+                expect($this->phDi->get('simpleProperties')->getResponse())->equals('response');
+
+                $component = $this->phDi->get('component');
+                expect($component->someProperty)->isInstanceOf('Phalcon\Config');
+                expect($this->phDi->get('component')->someProperty)->same($component->someProperty);
+
+                $stats = $this->phDi->getStats();
+
+                expect($stats['component']['resolutions'])->equals(2);
+                expect($stats['config']['resolutions'])->equals(2);
+                expect($stats['request']['resolutions'])->equals(1);
+                expect($stats['request']['time'])->greaterOrEquals(0);
+            }
+        );
+    }
 }
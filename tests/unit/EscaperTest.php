@@ -222,6 +222,30 @@ class EscaperTest extends UnitTest
         );
     }
 
+    /**
+     * Tests escaping UTF-8 strings with escapeJs and escapeCss
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testEscapeUtf8()
+    {
+        $this->specify(
+            'The escaper does not escape UTF-8 strings correctly',
+            function () {
+                $escaper = new Escaper();
+
+                expect($escaper->escapeJs("Привет, мир!"))->equals('\x41f\x440\x438\x432\x435\x442, \x43c\x438\x440!');
+                expect($escaper->escapeCss("a€b"))->equals('a\20ac b');
+
+                $source = str_repeat('Phalcon2018', 5);
+                expect($escaper->escapeJs($source))->equals($source);
+                expect($escaper->escapeCss($source . 'é'))->equals($source . '\e9 ');
+                expect($escaper->escapeJs($source . '<' . $source))->equals($source . '\x3c' . $source);
+            }
+        );
+    }
+
     /**
      * Tests the escapeUrl
      *
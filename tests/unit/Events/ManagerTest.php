@@ -337,6 +337,94 @@ class ManagerTest extends UnitTest
         );
     }
 
+    /**
+     * Tests that fired events reach listeners attached after a previous fire
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function fireAfterAttachingAndDetaching()
+    {
+        $this->specify(
+            'The Events Manager does not refresh the dispatch table after attaching or detaching listeners',
+            function ($enablePriorities) {
+                $manager = new Manager();
+                $manager->enablePriorities($enablePriorities);
+                $manager->collectResponses(true);
+
+                $manager->attach('other:event', function () {
+                    return 'other';
+                });
+
+                expect($manager->fire('test:event', $this))->null();
+
+                $group = function (Event $event) {
+                    return 'group:' . $event->getType();
+                };
+
+                $manager->attach('test', $group);
+                $manager->attach('test:event', function () {
+                    return 'event';
+                });
+
+                expect($manager->fire('test:event', $this))->equals('event');
+                expect($manager->getResponses())->equals(['group:event', 'event']);
+
+                $manager->detach('test', $group);
+
+                expect($manager->fire('test:event', $this))->equals('event');
+                expect($manager->getResponses())->equals(['event']);
+
+                $manager->detachAll('test:event');
+
+                expect($manager->fire('test:event', $this))->null();
+            },
+            [
+                'examples' => [
+                    [true ],
+                    [false],
+                ]
+            ]
+        );
+    }
+
+    /**
+     * Tests building the event data only when there are listeners
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function fireLazy()
+    {
+        $this->specify(
+            'The Events Manager builds the event data for unobserved events',
+            function () {
+                $manager = new Manager();
+                $built   = 0;
+                $builder = function () use (&$built) {
+                    $built++;
+                    return ['id' => 1];
+                };
+
+                $manager->attach('other:event', function () {
+                    return 'other';
+                });
+
+                expect($manager->fireLazy('test:event', $this, $builder))->null();
+                expect($built)->equals(0);
+
+                $manager->attach('test:event', function (Event $event, $source, $data) {
+                    return $data['id'];
+                });
+
+                expect($manager->fireLazy('test:event', $this, $builder))->equals(1);
+                expect($built)->equals(1);
+            }
+        );
+    }
+
     public function setLastListener($listener)
     {
         $this->listener = $listener;
@@ -183,4 +183,41 @@ class CookieTest extends HttpBase
             }
         );
     }
+
+    /**
+     * Tests sending a stateless cookie without accessing the session
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldNotUseSessionWhenStateless()
+    {
+        if (!extension_loaded('xdebug')) {
+            $this->markTestSkipped('Warning: xdebug extension is not loaded');
+        }
+
+        $this->specify(
+            'Stateless cookies access the session',
+            function () {
+                $di = new FactoryDefault();
+
+                $di->setShared('session', function () {
+                    throw new \RuntimeException('The session must not be used');
+                });
+
+                $cookie = new Cookie('test-stateless', 'test', time() + 3600, '/admin');
+                $cookie->setDI($di);
+                $cookie->setStateless(true);
+
+                expect($cookie->isStateless())->true();
+
+                $cookie->setPath('/stateless');
+                $cookie->send();
+
+                expect($cookie->getPath())->equals('/stateless');
+                expect($this->getCookie('test-stateless'))->contains('path=/stateless');
+            }
+        );
+    }
 }
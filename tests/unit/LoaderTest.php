@@ -387,4 +387,63 @@ class LoaderTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests Loader::dumpClassMap and the authoritative mode
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldDumpClassMap()
+    {
+        $this->specify(
+            'Class map is not dumped correctly',
+            function () {
+                $loader = new Loader();
+                $loader->setExtensions(['inc', 'php']);
+
+                $loader->registerClasses([
+                    'MoiTest' => PATH_DATA . 'vendor/Example/Test/MoiTest.php',
+                ]);
+
+                $loader->registerNamespaces([
+                    'Example\Engines' => PATH_DATA . 'vendor/Example/Engines',
+                ]);
+
+                $expected = [
+                    'MoiTest'                       => PATH_DATA . 'vendor/Example/Test/MoiTest.php',
+                    'Example\Engines\LeEngine'      => PATH_DATA . 'vendor/Example/Engines/LeEngine.php',
+                    'Example\Engines\LeEngine2'     => PATH_DATA . 'vendor/Example/Engines/LeEngine2.php',
+                    'Example\Engines\LeOtherEngine' => PATH_DATA . 'vendor/Example/Engines/LeOtherEngine.inc',
+                ];
+
+                $classMap = $loader->dumpClassMap(PATH_CACHE . 'classmap.php');
+
+                ksort($classMap);
+                ksort($expected);
+
+                expect($classMap)->equals($expected);
+
+                $this->tester->amInPath(PATH_CACHE);
+                $this->tester->seeFileFound('classmap.php');
+
+                $classMap = require PATH_CACHE . 'classmap.php';
+                ksort($classMap);
+
+                expect($classMap)->equals($expected);
+
+                $this->tester->deleteFile('classmap.php');
+
+                expect($loader->autoLoad('Example\Engines\LeMissingEngine'))->false();
+                expect($loader->getStats()['fileChecks'])->equals(2);
+
+                $loader->registerClasses($classMap);
+                $loader->setAuthoritative(true);
+
+                expect($loader->autoLoad('Example\Engines\LeMissingEngine'))->false();
+                expect($loader->getStats()['fileChecks'])->equals(2);
+            }
+        );
+    }
 }
@@ -3,7 +3,11 @@
 namespace Phalcon\Test\Unit\Mvc\Model;
 
 use Phalcon\Di;
+use Phalcon\Mvc\Model\Row;
 use Phalcon\Mvc\Model\Manager;
+use Phalcon\Mvc\Model\Resultset\Simple;
+use Phalcon\Events\Manager as EventsManager;
+use Phalcon\Paginator\Adapter\QueryBuilder;
 use Phalcon\Test\Models\Robots;
 use Phalcon\Test\Module\UnitTest;
 use Phalcon\Test\Models\Customers;
@@ -170,4 +174,124 @@ class ManagerTest extends UnitTest
             ]
         );
     }
+
+    /**
+     * Tests eager loading relations with Model::find and Builder::with
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldEagerLoadRelations()
+    {
+        $this->specify(
+            "Relations are not eager loaded as expected",
+            function () {
+                $with = [
+                    Relations\RelationsRobotsParts::class,
+                    Relations\RelationsRobotsParts::class . '.' . Relations\RelationsParts::class,
+                    Relations\RelationsParts::class,
+                ];
+
+                $db = Di::getDefault()->getShared('db');
+                $eventsManager = $db->getEventsManager();
+
+                // Load the metadata before counting the queries
+                Relations\RelationsRobots::find(['with' => $with]);
+
+                $queries = 0;
+                $counter = new EventsManager();
+                $counter->attach(
+                    'db:beforeQuery',
+                    function () use (&$queries) {
+                        $queries++;
+                    }
+                );
+                $db->setEventsManager($counter);
+
+                $robots = Relations\RelationsRobots::find(['with' => $with]);
+
+                // One query for the robots, robots parts and their parts, two
+                // for the parts through the intermediate model
+                expect($queries)->equals(5);
+
+                $related = [];
+                foreach ($robots as $robot) {
+                    $robotsParts = $robot->getRelated(Relations\RelationsRobotsParts::class);
+                    expect($robotsParts)->isInstanceOf(Simple::class);
+                    expect($robot->getRelated(Relations\RelationsParts::class))->isInstanceOf(Simple::class);
+
+                    foreach ($robotsParts as $robotPart) {
+                        expect($robotPart->robots_id)->equals($robot->id);
+                        expect($robotPart->getRelated(Relations\RelationsParts::class)->id)->equals($robotPart->parts_id);
+                    }
+
+                    $related[$robot->id] = [count($robotsParts), count($robot->getRelated(Relations\RelationsParts::class))];
+                }
+
+                expect($queries)->equals(5);
+
+                $db->setEventsManager($eventsManager);
+
+                foreach ($robots as $robot) {
+                    $count = Relations\RelationsRobotsParts::count(['robots_id = ?0', 'bind' => [$robot->id]]);
+                    expect($related[$robot->id])->equals([$count, $count]);
+                }
+
+                $robot = Di::getDefault()->getShared('modelsManager')
+                    ->createBuilder()
+                    ->from(Relations\RelationsRobots::class)
+                    ->with([Relations\RelationsRobotsParts::class => ['parts_id = 0']])
+                    ->limit(1)
+                    ->getQuery()
+                    ->execute()
+                    ->getFirst();
+
+                expect($robot->getRelated(Relations\RelationsRobotsParts::class))->isInstanceOf(Simple::class);
+                expect($robot->getRelated(Relations\RelationsRobotsParts::class))->count(0);
+            }
+        );
+    }
+
+    /**
+     * Tests Builder::with on queries of scalar columns and paginated queries
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldIgnoreEagerLoadsWithoutCompleteRecords()
+    {
+        $this->specify(
+            "Relations are eager loaded on rows of scalar columns",
+            function () {
+                $builder = Di::getDefault()->getShared('modelsManager')
+                    ->createBuilder()
+                    ->from(Relations\RelationsRobots::class)
+                    ->with([Relations\RelationsRobotsParts::class]);
+
+                $columns = clone $builder;
+                $rows = $columns->columns('id, name')->getQuery()->execute();
+
+                expect($rows->getFirst())->isInstanceOf(Row::class);
+                expect($rows)->count(Relations\RelationsRobots::count());
+
+                $paginator = new QueryBuilder(
+                    [
+                        'builder' => $builder,
+                        'limit'   => 2,
+                        'page'    => 1,
+                    ]
+                );
+
+                $page = $paginator->getPaginate();
+
+                expect($page->total_items)->equals(Relations\RelationsRobots::count());
+
+                foreach ($page->items as $robot) {
+                    expect($robot->getRelated(Relations\RelationsRobotsParts::class))->isInstanceOf(Simple::class);
+                }
+            }
+        );
+    }
 }
@@ -0,0 +1,97 @@
+<?php
+
+namespace Phalcon\Test\Unit\Mvc\Model\MetaData;
+
+use UnitTester;
+use Phalcon\Test\Models\Robots;
+use Phalcon\Mvc\Model\Metadata\Compiled;
+
+/**
+ * \Phalcon\Test\Unit\Mvc\Model\Metadata\CompiledCest
+ * Tests the \Phalcon\Mvc\Model\Metadata\Compiled component
+ *
+ * @copyright (c) 2011-2018 Phalcon Team
+ * @link      https://phalconphp.com
+ * @author    Phalcon Team <team@phalconphp.com>
+ * @package   Phalcon\Test\Unit\Mvc\Model\Metadata
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+class CompiledCest
+{
+    private $data;
+
+    public function _before(UnitTester $I)
+    {
+        $I->haveServiceInDi('modelsMetadata', function () {
+            return new Compiled([
+                'metaDataFile' => PATH_CACHE . 'metadata.php',
+            ]);
+        }, true);
+
+        $this->data = require PATH_FIXTURES . 'metadata/robots.php';
+    }
+
+    public function compiled(UnitTester $I)
+    {
+        $I->wantTo('fetch metadata from a compiled file');
+
+        /** @var \Phalcon\Mvc\Model\Metadata\Compiled $md */
+        $md = $I->grabServiceFromDi('modelsMetadata');
+
+        $compiled = $md->compile([Robots::class]);
+
+        $I->amInPath(PATH_CACHE);
+        $I->seeFileFound('metadata.php');
+
+        $I->assertEquals(
+            $compiled,
+            require PATH_CACHE . 'metadata.php'
+        );
+
+        $I->assertEquals(
+            $this->data['meta-robots-robots'],
+            $compiled['meta-phalcon\test\models\robots-robots']
+        );
+
+        $I->assertEquals(
+            $this->data['map-robots'],
+            $compiled['map-phalcon\test\models\robots']
+        );
+
+        $md = new Compiled([
+            'metaDataFile' => PATH_CACHE . 'metadata.php',
+        ]);
+
+        $I->assertEquals(
+            $this->data['meta-robots-robots'],
+            $md->readMetaData(new Robots())
+        );
+
+        $I->deleteFile('metadata.php');
+    }
+
+    public function compiledFile(UnitTester $I)
+    {
+        $I->wantTo('fetch metadata from an existing compiled file');
+
+        $md = new Compiled([
+            'metaDataFile' => PATH_FIXTURES . 'metadata/compiled.php',
+        ]);
+
+        $I->assertEquals(
+            $this->data['meta-robots-robots'],
+            $md->readMetaData(new Robots())
+        );
+
+        $I->assertEquals(
+            $this->data['map-robots'],
+            $md->read('map-phalcon\test\models\robots')
+        );
+    }
+}
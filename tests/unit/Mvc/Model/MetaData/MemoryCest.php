@@ -4,6 +4,7 @@ namespace Phalcon\Test\Unit\Mvc\Model\MetaData;
 
 use UnitTester;
 use Phalcon\Test\Models\Robots;
+use Phalcon\Test\Models\RobotsParts;
 use Phalcon\Test\Models\Robotto;
 use Phalcon\Mvc\Model\Metadata\Memory;
 
@@ -93,4 +94,29 @@ class MemoryCest
 
         $I->assertEquals($metaData->getIdentityField($robotto), 'id');
     }
+
+    public function warmUp(UnitTester $I)
+    {
+        $I->wantTo('load the metadata of many models at once');
+
+        /** @var \Phalcon\Mvc\Model\MetaData $md */
+        $md = $I->grabServiceFromDi('modelsMetadata');
+
+        $md->reset();
+        $md->warmUp([Robots::class, RobotsParts::class]);
+
+        $I->assertFalse($md->isEmpty());
+
+        $I->assertEquals(
+            $this->data['meta-robots-robots'],
+            $md->readMetaData(new Robots())
+        );
+
+        $I->assertEquals(
+            ['id', 'robots_id', 'parts_id'],
+            $md->getAttributes(new RobotsParts())
+        );
+
+        $md->reset();
+    }
 }
@@ -2,6 +2,8 @@
 
 namespace Phalcon\Test\Unit\Mvc\Model\Query;
 
+use Phalcon\Mvc\Model\Query;
+use Phalcon\Mvc\Model\Exception;
 use Phalcon\Mvc\Model\Query\Builder;
 use Phalcon\Test\Module\UnitTest;
 use Phalcon\Test\Models\Robots;
@@ -721,6 +723,85 @@ class BuilderTest extends UnitTest
         );
     }
 
+    /**
+     * Tests assembling the AST of the query from the parsed clauses
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldBuildAstWithoutParsingTheStatement()
+    {
+        $this->specify(
+            'The builder does not assemble the AST of the statement as expected',
+            function () {
+                $queries = [];
+                foreach ([[2, 0], [3, 1]] as $page) {
+                    $builder = new Builder(null, $this->di);
+                    $queries[] = $builder
+                        ->columns(['id', 'name'])
+                        ->from(Robots::class)
+                        ->where('type = :type:', ['type' => 'mechanical'])
+                        ->orderBy('id')
+                        ->limit($page[0], $page[1])
+                        ->getQuery();
+                }
+
+                $phql = 'SELECT id, name FROM [' . Robots::class . '] ' .
+                    'WHERE type = :type: ORDER BY id LIMIT :APL0: OFFSET :APL1:';
+
+                $parsed = new Query($phql, $this->di);
+
+                foreach ($queries as $query) {
+                    $ast = $this->tester->getProtectedProperty($query, '_ast');
+
+                    expect($ast['id'])->equals('_PHQB' . md5($phql));
+                    expect($query->getSql())->equals($parsed->getSql());
+                }
+
+                expect($queries[0]->getBindParams())->equals(['type' => 'mechanical', 'APL0' => 2, 'APL1' => 0]);
+                expect($queries[1]->getBindParams())->equals(['type' => 'mechanical', 'APL0' => 3, 'APL1' => 1]);
+                expect($queries[1]->execute()->toArray())->equals(
+                    Robots::find(
+                        [
+                            'type = :type:',
+                            'bind'    => ['type' => 'mechanical'],
+                            'columns' => 'id, name',
+                            'order'   => 'id',
+                            'limit'   => 3,
+                            'offset'  => 1,
+                        ]
+                    )->toArray()
+                );
+            }
+        );
+    }
+
+    /**
+     * Tests reporting the syntax errors of the clauses when the query is parsed
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldReportSyntaxErrorsWhenParsing()
+    {
+        $this->specify(
+            'The builder reports the syntax errors before the query is parsed',
+            function () {
+                $builder = new Builder(null, $this->di);
+                $query = $builder->from(Robots::class)->where('id = ')->getQuery();
+
+                expect($this->tester->getProtectedProperty($query, '_ast'))->null();
+
+                $query->getSql();
+            },
+            [
+                'throws' => [Exception::class],
+            ]
+        );
+    }
+
     protected function limitOffsetProvider()
     {
         return [
@@ -18,6 +18,7 @@
 namespace Phalcon\Test\Unit\Mvc\Model;
 
 use Phalcon\DiInterface;
+use Phalcon\Mvc\Model;
 use Phalcon\Mvc\Model\Query;
 use Phalcon\Mvc\Model\Transaction;
 use Phalcon\Test\Module\UnitTest;
@@ -152,4 +153,123 @@ class QueryTest extends UnitTest
             ]
         );
     }
+
+    /**
+     * Tests Query::parse by using the cross-request PHQL cache
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldParseByUsingPersistentCache()
+    {
+        if (!extension_loaded('apcu') || !ini_get('apc.enable_cli')) {
+            $this->markTestSkipped('Warning: APCu extension is not loaded or disabled for CLI');
+        }
+
+        $this->specify(
+            "The cross-request PHQL cache doesn't work as expected",
+            function () {
+                $phql = 'SELECT * FROM Robots WHERE id > 2';
+
+                Query::cleanPersistent();
+                Model::setup(['persistentPhqlCache' => true, 'metaDataVersion' => 7]);
+
+                $query = new Query($phql);
+                $query->setDI($this->di);
+                $expected = $query->parse();
+
+                expect(apcu_exists('_PHQL7_' . md5($phql)))->true();
+
+                Query::clean();
+
+                $query = new Query($phql);
+                $query->setDI($this->di);
+
+                expect($query->parse())->equals($expected);
+                expect($query->getType())->equals(Query::TYPE_SELECT);
+
+                Model::setup(['persistentPhqlCache' => false, 'metaDataVersion' => 0]);
+                Query::cleanPersistent();
+            }
+        );
+    }
+
+    /**
+     * Tests the cross-request PHQL cache only counts the statements added
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldLimitPersistentCache()
+    {
+        if (!extension_loaded('apcu') || !ini_get('apc.enable_cli')) {
+            $this->markTestSkipped('Warning: APCu extension is not loaded or disabled for CLI');
+        }
+
+        $this->specify(
+            "The cross-request PHQL cache doesn't count the stored statements as expected",
+            function () {
+                Query::cleanPersistent();
+                Model::setup(['metaDataVersion' => 7, 'persistentPhqlCacheSize' => 2]);
+
+                $store = new \ReflectionMethod(Query::class, 'storePersistentCache');
+                $store->setAccessible(true);
+
+                expect($store->invoke(null, '_PHQL7_first', ['type' => 309]))->true();
+
+                // Statements already stored by another process aren't counted again
+                expect($store->invoke(null, '_PHQL7_first', ['type' => 309]))->false();
+                expect(apcu_fetch('_PHQL7_count'))->equals(1);
+
+                expect($store->invoke(null, '_PHQL7_second', ['type' => 309]))->true();
+                expect($store->invoke(null, '_PHQL7_third', ['type' => 309]))->false();
+                expect(apcu_exists('_PHQL7_third'))->false();
+                expect(apcu_fetch('_PHQL7_count'))->equals(2);
+
+                Model::setup(['metaDataVersion' => 0, 'persistentPhqlCacheSize' => 4096]);
+                Query::cleanPersistent();
+            }
+        );
+    }
+
+    /**
+     * Tests the SQL cache with several bind shapes
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldCacheSqlByBindShape()
+    {
+        $this->specify(
+            "The SQL cache doesn't take the bind shape into account",
+            function () {
+                $phql = 'SELECT * FROM Robots WHERE id IN ({ids:array})';
+
+                Query::clean();
+
+                $query = new Query($phql, $this->di);
+
+                $query->setBindParams(['ids' => [1, 2]]);
+                $two = $query->getSql();
+
+                $query->setBindParams(['ids' => [1, 2, 3]]);
+                $three = $query->getSql();
+
+                expect(substr_count($two['sql'], ':ids'))->equals(2);
+                expect(substr_count($three['sql'], ':ids'))->equals(3);
+
+                $query = new Query($phql, $this->di);
+                $query->setBindParams(['ids' => [3, 4]]);
+
+                expect($query->getSql()['sql'])->equals($two['sql']);
+
+                $robots = $this->di->get('modelsManager')->executeQuery($phql, ['ids' => [1, 2, 3]]);
+
+                expect($robots)->count(3);
+            }
+        );
+    }
 }
@@ -6,6 +6,9 @@ use Phalcon\Di;
 use Phalcon\Test\Models\Robots;
 use Phalcon\Test\Models\People;
 use Helper\ResultsetHelperTrait;
+use Phalcon\Mvc\Model;
+use Phalcon\Mvc\Model\Resultset;
+use Phalcon\Db\Column;
 use Phalcon\Test\Module\UnitTest;
 use Phalcon\Mvc\Model\Resultset\Simple;
 
@@ -290,4 +293,144 @@ class SimpleTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests traversing a forward-only streaming resultset
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldStreamResultset()
+    {
+        $this->specify(
+            'Streaming Simple Resultset does not work as expected',
+            function () {
+                $expected = [];
+                foreach (Robots::find(['order' => 'id']) as $robot) {
+                    $expected[] = $robot->id;
+                }
+
+                $robots = Robots::find([
+                    'order'  => 'id',
+                    'stream' => true,
+                ]);
+
+                expect($robots)->isInstanceOf(Simple::class);
+                expect($robots->isStreaming())->true();
+
+                $actual = [];
+                foreach ($robots as $robot) {
+                    expect($robot)->isInstanceOf(Robots::class);
+                    $actual[] = $robot->id;
+                }
+
+                expect($actual)->equals($expected);
+
+                try {
+                    $robots->count();
+                    $counted = true;
+                } catch (\Phalcon\Mvc\Model\Exception $e) {
+                    $counted = false;
+                    expect($e->getMessage())->equals("Streaming resultsets can't be counted");
+                }
+
+                expect($counted)->false();
+
+                try {
+                    foreach ($robots as $robot) {
+                    }
+                    $rewound = true;
+                } catch (\Phalcon\Mvc\Model\Exception $e) {
+                    $rewound = false;
+                    expect($e->getMessage())->equals("Streaming resultsets can only be traversed forward");
+                }
+
+                expect($rewound)->false();
+            }
+        );
+    }
+
+    /**
+     * Tests hydrating rows with a hydration plan
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldHydrateWithPlan()
+    {
+        $this->specify(
+            'The hydration plan does not produce the same result',
+            function () {
+                $columnMap = [
+                    'id'   => ['code', Column::TYPE_INTEGER],
+                    'name' => ['theName', Column::TYPE_VARCHAR],
+                    'year' => 'theYear',
+                ];
+
+                $row  = ['id' => '1', 'name' => 'Robotina', 'year' => '1972', 0 => 'ignored'];
+                $plan = Model::getHydrationPlan($row, $columnMap);
+
+                expect($plan)->equals(
+                    [
+                        ['id', 'code', 1],
+                        ['name', 'theName', 0],
+                        ['year', 'theYear', 0],
+                    ]
+                );
+
+                expect(Model::cloneResultMapHydratePlan($row, $plan, Resultset::HYDRATE_ARRAYS))->equals(
+                    Model::cloneResultMapHydrate($row, $columnMap, Resultset::HYDRATE_ARRAYS)
+                );
+
+                $robot = Model::cloneResultMapPlan(new Robots(), $row, $plan, $columnMap);
+
+                expect($robot->code)->same(1);
+                expect($robot->theName)->equals('Robotina');
+
+                $robots = Robots::find(['order' => 'id']);
+
+                expect($robots->getFirst()->id)->equals(1);
+                expect($robots->getLast()->id)->equals(3);
+            }
+        );
+    }
+
+    /**
+     * Tests saving every record of a resultset with multi-row upserts
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldSaveAllWithoutEvents()
+    {
+        $this->specify(
+            'The records of the resultset are not saved as expected',
+            function () {
+                $connection = Di::getDefault()->getShared('db');
+                $years = [];
+
+                foreach (Robots::find(['order' => 'id']) as $robot) {
+                    $years[$robot->id] = $robot->year;
+                }
+
+                try {
+                    $robots = Robots::find(['order' => 'id']);
+
+                    expect($robots->saveAll(['year' => 2018], false, 2))->true();
+                    expect(Robots::count())->equals(count($years));
+                    expect(Robots::count('year = 2018'))->equals(count($years));
+
+                    expect($robots->saveAll(['year' => 2017]))->true();
+                    expect(Robots::count('year = 2017'))->equals(count($years));
+                } finally {
+                    foreach ($years as $id => $year) {
+                        $connection->update('robots', ['year'], [$year], 'id = ' . $id);
+                    }
+                }
+            }
+        );
+    }
 }
@@ -4,7 +4,9 @@ namespace Phalcon\Test\Unit\Mvc;
 
 use DateTime;
 use Helper\ModelTrait;
+use Phalcon\Di;
 use Phalcon\Mvc\Model;
+use Phalcon\Events\Manager as EventsManager;
 use Phalcon\Mvc\Model\Message;
 use Phalcon\Test\Models\ModelWithStringField;
 use Phalcon\Test\Models\Users;
@@ -582,6 +584,91 @@ class ModelTest extends UnitTest
         );
     }
 
+    /**
+     * Tests Model::batchCreate with a column map, events and chunks
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testBatchCreate()
+    {
+        $this->specify(
+            'The records are not created in batch correctly',
+            function () {
+                $modelsManager = $this->setUpModelsManager();
+                $connection = Di::getDefault()->getShared('db');
+
+                $fired = [];
+                $saved = [];
+
+                $eventsManager = new EventsManager();
+                $eventsManager->attach(
+                    'model',
+                    function ($event, $robot) use (&$fired, &$saved) {
+                        $fired[] = $event->getType() . ':' . $robot->theName;
+
+                        if ($event->getType() == 'afterSave') {
+                            $saved[$robot->theName] = $robot->code;
+                        }
+
+                        if ($event->getType() == 'beforeSave' && $robot->theName == 'batch-cancelled') {
+                            return false;
+                        }
+
+                        return true;
+                    }
+                );
+                $modelsManager->setEventsManager($eventsManager);
+
+                $rows = [];
+                foreach (['batch-1', 'batch-cancelled', 'batch-2', 'batch-3', 'batch-4'] as $name) {
+                    $rows[] = [
+                        'theName'     => $name,
+                        'theType'     => 'mechanical',
+                        'theYear'     => 2018,
+                        'theDatetime' => '2018-06-01 00:00:00',
+                        'theText'     => 'batch',
+                    ];
+                }
+
+                try {
+                    // 4 records in chunks of 3 rows
+                    $ids = Robotters::batchCreate($rows, true, 3);
+                    expect($ids)->count(4);
+
+                    $robots = Robotters::find([
+                        'theText = "batch"',
+                        'order' => 'code',
+                    ]);
+
+                    expect($robots)->count(4);
+                    expect($robots[0]->theName)->equals('batch-1');
+                    expect($robots[3]->theName)->equals('batch-4');
+
+                    // The generated ids are returned and assigned to the records
+                    foreach ($robots as $position => $robot) {
+                        expect($ids[$position])->equals($robot->code);
+                        expect($saved[$robot->theName])->equals($robot->code);
+                    }
+
+                    expect($fired)->contains('beforeValidationOnCreate:batch-cancelled');
+                    expect($fired)->notContains('beforeCreate:batch-cancelled');
+                    expect($fired)->notContains('afterSave:batch-cancelled');
+                    expect($fired)->contains('beforeValidationOnCreate:batch-4');
+                    expect($fired)->contains('afterCreate:batch-4');
+                    expect($fired)->contains('afterSave:batch-4');
+
+                    // Without events every row is inserted
+                    $eventsManager->detachAll('model');
+                    expect(Robotters::batchCreate(array_slice($rows, 0, 2), false, 1))->count(2);
+                    expect(Robotters::count('theText = "batch"'))->equals(6);
+                } finally {
+                    $connection->delete('robots', "text = 'batch'");
+                }
+            }
+        );
+    }
+
     /**
      * @issue https://github.com/phalcon/cphalcon/issues/12507
      */
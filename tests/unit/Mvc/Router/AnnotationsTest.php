@@ -194,4 +194,58 @@ class AnnotationsTest extends UnitTest
             ]
         );
     }
+
+    /**
+     * Tests storing the routes read from the resources
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testRouterCompiledResources()
+    {
+        $this->specify(
+            "The Annotations Router doesn't use the compiled routes properly",
+            function () {
+                $di = $this->_getDI();
+
+                $router = new Annotations(false);
+                $router->setDI($di);
+
+                $router->addResource("Robots", "/");
+                $router->addResource("Products", "/products");
+                $router->addResource("About", "/about");
+
+                $router->useCompiledResources("compiled-routes");
+
+                expect($router->getCompiledKey())->equals("compiled-routes");
+                expect($router->compileResources())->count(8);
+                expect($router->getRoutes())->count(0);
+
+                $router->handle("/products");
+
+                expect($router->getRoutes())->count(6);
+                expect($di["annotations"]->read("compiled-routes"))->isInstanceOf(\Phalcon\Annotations\Reflection::class);
+
+                /**
+                 * The resources are not read again
+                 */
+                $router = new Annotations(false);
+                $router->setDI($di);
+
+                $router->useCompiledResources("compiled-routes");
+
+                $_SERVER["REQUEST_METHOD"] = "GET";
+                $router->handle("/products/edit/100");
+
+                expect($router->getRoutes())->count(6);
+                expect($router->getControllerName())->equals("products");
+                expect($router->getActionName())->equals("edit");
+                expect($router->getParams())->equals(["id" => "100"]);
+
+                $route = $router->getRouteByName("save-product");
+                expect($route)->isInstanceOf(Route::class);
+                expect($route->getHttpMethods())->equals(["POST", "PUT"]);
+            }
+        );
+    }
 }
@@ -422,4 +422,153 @@ class RouterTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests matching through the compiled route table
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldMatchWithCompiledRoutes()
+    {
+        $pathToRouterData = include PATH_FIXTURES . 'mvc/router_test/data_to_router_http.php';
+        $this->specify(
+            'Router does not matched correctly by using compiled routes',
+            function ($params) use ($pathToRouterData) {
+                $router = $this->getRouterAndSetRoutes($pathToRouterData);
+                $router->useCompiledRoutes(true);
+
+                $_SERVER['REQUEST_METHOD'] = $params['method'];
+                $router->handle($params['uri']);
+
+                expect($router->getControllerName())->equals($params['controller']);
+                expect($router->getActionName())->equals($params['action']);
+                expect($router->getParams())->equals($params['params']);
+            },
+            [
+                'examples' => include PATH_FIXTURES . 'mvc/router_test/matching_with_router_http.php'
+            ]
+        );
+    }
+
+    /**
+     * Tests compiled route table gives the same results as the linear scan
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldMatchTheSameRoutesWhenCompiled()
+    {
+        $this->specify(
+            'Compiled routes does not match the same routes as the linear scan',
+            function ($total) {
+                $linear = $this->getRouter();
+                $compiled = $this->getRouter();
+                $compiled->useCompiledRoutes(true);
+
+                foreach ([$linear, $compiled] as $router) {
+                    for ($i = 0; $i < $total; $i++) {
+                        $router->addGet('/section' . $i . '/{id:[0-9]+}', ['controller' => 'get' . $i, 'action' => 'show']);
+                        $router->addPost('/section' . $i . '/{id:[0-9]+}', ['controller' => 'post' . $i, 'action' => 'save']);
+                        $router->add('/section' . $i . '/about', ['controller' => 'static' . $i, 'action' => 'about']);
+                    }
+
+                    $router->add('/{slug:[a-z]+}/latest', ['controller' => 'slug', 'action' => 'latest']);
+                }
+
+                foreach (['GET', 'POST', 'PUT'] as $method) {
+                    $_SERVER['REQUEST_METHOD'] = $method;
+
+                    foreach (['/section0/12', '/section' . ($total - 1) . '/about', '/news/latest', '/section0/latest', '/missing/route'] as $uri) {
+                        $linear->handle($uri);
+                        $compiled->handle($uri);
+
+                        expect($compiled->wasMatched())->equals($linear->wasMatched());
+                        expect($compiled->getActionName())->equals($linear->getActionName());
+                        expect($compiled->getControllerName())->equals($linear->getControllerName());
+                        expect($compiled->getParams())->equals($linear->getParams());
+                    }
+                }
+            },
+            [
+                'examples' => [
+                    [10],
+                    [100],
+                    [1000],
+                ]
+            ]
+        );
+    }
+
+    /**
+     * Tests compiled route table only keeps the routes matching the HTTP
+     * method and the first segment of the URI
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldPruneCompiledRoutes()
+    {
+        $this->specify(
+            'Compiled routes are not pruned by HTTP method and first segment',
+            function ($total) {
+                $router = $this->getRouter(false);
+
+                for ($i = 0; $i < $total; $i++) {
+                    $router->addGet('/section' . $i . '/{id:[0-9]+}', ['controller' => 'get' . $i, 'action' => 'show']);
+                    $router->addPost('/section' . $i . '/{id:[0-9]+}', ['controller' => 'post' . $i, 'action' => 'save']);
+                    $router->add('/section' . $i . '/about', ['controller' => 'static' . $i, 'action' => 'about']);
+                }
+
+                $router->add('/{slug:[a-z]+}/latest', ['controller' => 'slug', 'action' => 'latest']);
+
+                $table = $router->compileRoutes();
+
+                expect(array_keys($table))->equals(['*', 'GET', 'POST']);
+
+                $candidates = function ($method, $segment) use ($table) {
+                    $bucket = $table[$method];
+                    $routes = isset($bucket['segments'][$segment]) ? $bucket['segments'][$segment] : $bucket['wildcards'];
+
+                    return array_map(
+                        function ($route) {
+                            return $route->getPattern();
+                        },
+                        $routes
+                    );
+                };
+
+                $last = $total - 1;
+
+                expect($candidates('GET', 'section' . $last))->equals([
+                    '/section' . $last . '/{id:[0-9]+}',
+                    '/section' . $last . '/about',
+                    '/{slug:[a-z]+}/latest',
+                ]);
+
+                expect($candidates('POST', 'section0'))->equals([
+                    '/section0/{id:[0-9]+}',
+                    '/section0/about',
+                    '/{slug:[a-z]+}/latest',
+                ]);
+
+                expect($candidates('*', 'section0'))->equals([
+                    '/section0/about',
+                    '/{slug:[a-z]+}/latest',
+                ]);
+
+                expect($candidates('GET', 'news'))->equals(['/{slug:[a-z]+}/latest']);
+            },
+            [
+                'examples' => [
+                    [10],
+                    [100],
+                    [1000],
+                ]
+            ]
+        );
+    }
 }
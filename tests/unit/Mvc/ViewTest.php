@@ -675,6 +675,84 @@ class ViewTest extends UnitTest
         );
     }
 
+    /**
+     * Tests rendering views from the manifest built by compileAll
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testRenderFromManifest()
+    {
+        $this->specify(
+            "Views are not rendered from the manifest",
+            function () {
+                $viewsDir = PATH_DATA . 'views' . DIRECTORY_SEPARATOR;
+
+                $view = new View;
+                $view->setDI(Di::getDefault());
+                $view->setViewsDir($viewsDir);
+
+                $manifest = $view->compileAll();
+
+                expect($manifest['views'][$viewsDir . 'test3/other'])->equals('.phtml');
+                expect($manifest['views'][$viewsDir . 'layouts/test6'])->equals('.phtml');
+                expect($manifest['compiled'])->equals([]);
+
+                $view->setManifest($manifest);
+
+                expect($view->exists('test3/other'))->true();
+                expect($view->exists('test3/unknown'))->false();
+
+                $view->start();
+                $view->setLayout('test6');
+                $view->render('test3', 'other');
+                $view->finish();
+
+                expect($view->getContent())->equals("<html>Well, this is the view content: here.</html>\n");
+
+                $view->setManifest(['views' => [], 'compiled' => []]);
+
+                expect($view->exists('test3/other'))->false();
+
+                $view->setManifest(null);
+
+                expect($view->exists('test3/other'))->true();
+            }
+        );
+    }
+
+    /**
+     * Tests rendering from a manifest with an extension without engine
+     *
+     * @test
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function shouldNotRenderManifestWithoutEngine()
+    {
+        $viewsDir = PATH_DATA . 'views' . DIRECTORY_SEPARATOR;
+
+        $this->specify(
+            "Views are rendered from the manifest without a registered engine",
+            function () use ($viewsDir) {
+                $view = new View;
+                $view->setDI(Di::getDefault());
+                $view->setViewsDir($viewsDir);
+                $view->setManifest(['views' => [$viewsDir . 'test3/other' => '.volt'], 'compiled' => []]);
+
+                $view->start();
+                $view->render('test3', 'other');
+                $view->finish();
+            },
+            [
+                'throws' => [
+                    Exception::class,
+                    "The view '" . $viewsDir . "test3/other' of the manifest requires an engine for the extension: .volt",
+                ],
+            ]
+        );
+    }
+
     private function _getDi($service = 'viewCache', $lifetime = 60)
     {
         $di = new Di();
@@ -4,8 +4,12 @@ namespace Phalcon\Test\Unit\Paginator\Adapter;
 
 use Helper\ModelTrait;
 use Phalcon\Di;
+use Phalcon\Mvc\Model\Resultset;
 use Phalcon\Paginator\Adapter\QueryBuilder;
 use Phalcon\Test\Models\Robos;
+use Phalcon\Test\Models\Robots;
+use Phalcon\Cache\Backend\Memory as MemoryCache;
+use Phalcon\Cache\Frontend\Data as DataFrontend;
 use Phalcon\Test\Models\Stock;
 use Phalcon\Test\Module\UnitTest;
 
@@ -170,4 +174,138 @@ class QueryBuilderTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests query builder pagination without counting the records
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testPaginateWithoutCount()
+    {
+        $this->specify(
+            "Query builder paginator doesn't detect the next page correctly",
+            function () {
+                $modelsManager = $this->setUpModelsManager();
+                $builder = $modelsManager->createBuilder()
+                    ->from(Robots::class)
+                    ->orderBy('id');
+
+                $paginator = new QueryBuilder(
+                    [
+                        "builder" => $builder,
+                        "limit"   => 2,
+                        "page"    => 1,
+                        "count"   => QueryBuilder::COUNT_NONE,
+                    ]
+                );
+
+                $page = $paginator->getPaginate();
+
+                expect($page->items)->isInstanceOf(Resultset::class);
+                expect($page->items)->count(2);
+                expect($page->items->getLast()->id)->equals(2);
+                expect($page->next)->equals(2);
+                expect($page->total_items)->null();
+
+                $page = $paginator->setCurrentPage(2)->getPaginate();
+
+                expect($page->items)->count(1);
+                expect($page->items[0]->name)->equals('Terminator');
+                expect($page->before)->equals(1);
+                expect($page->next)->equals(2);
+            }
+        );
+    }
+
+    /**
+     * Tests query builder pagination with a cached count
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testPaginateWithCachedCount()
+    {
+        $this->specify(
+            "Query builder paginator doesn't cache the count correctly",
+            function () {
+                $modelsManager = $this->setUpModelsManager();
+                $modelsManager->getDI()->setShared(
+                    'modelsCache',
+                    new MemoryCache(new DataFrontend(['lifetime' => 20]))
+                );
+
+                $builder = $modelsManager->createBuilder()
+                    ->from(Robots::class)
+                    ->orderBy('id');
+
+                $config = [
+                    "builder"  => $builder,
+                    "limit"    => 2,
+                    "page"     => 1,
+                    "count"    => QueryBuilder::COUNT_CACHED,
+                    "countKey" => "robots-count",
+                ];
+
+                $page = (new QueryBuilder($config))->getPaginate();
+
+                expect($page->total_items)->equals(3);
+                expect($page->total_pages)->equals(2);
+
+                $modelsManager->getDI()->getShared('modelsCache')->save('robots-count', 10);
+
+                $page = (new QueryBuilder($config))->getPaginate();
+
+                expect($page->total_items)->equals(10);
+                expect($page->total_pages)->equals(5);
+            }
+        );
+    }
+
+    /**
+     * Tests query builder keyset pagination
+     *
+     * @author Phalcon Team <team@phalconphp.com>
+     * @since  2018-06-01
+     */
+    public function testPaginateWithCursor()
+    {
+        $this->specify(
+            "Query builder paginator doesn't seek with the cursor correctly",
+            function () {
+                $modelsManager = $this->setUpModelsManager();
+                $builder = $modelsManager->createBuilder()
+                    ->from(Robots::class);
+
+                $config = [
+                    "builder" => $builder,
+                    "limit"   => 2,
+                    "cursor"  => "id",
+                ];
+
+                $page = (new QueryBuilder($config))->getPaginate();
+
+                expect($page->items)->isInstanceOf(Resultset::class);
+                expect($page->items)->count(2);
+                expect($page->before)->null();
+                expect($page->next)->equals(2);
+
+                $page = (new QueryBuilder($config + ["after" => $page->next]))->getPaginate();
+
+                expect($page->items)->count(1);
+                expect($page->items[0]->id)->equals(3);
+                expect($page->before)->equals(3);
+                expect($page->next)->null();
+
+                $page = (new QueryBuilder($config + ["before" => $page->before]))->getPaginate();
+
+                expect($page->items)->count(2);
+                expect($page->items[0]->id)->equals(1);
+                expect($page->items[1]->id)->equals(2);
+                expect(array_column($page->items->toArray(), 'id'))->equals([1, 2]);
+                expect($page->before)->null();
+                expect($page->next)->equals(2);
+            }
+        );
+    }
 }